@@ -56,6 +56,22 @@
 #define RTTI_CFG_CREATE_STD_STRING_TYPE 1
 #endif
 
+#ifndef RTTI_CFG_CHANGE_TRACKING
+#define RTTI_CFG_CHANGE_TRACKING 0
+#endif
+
+#ifndef RTTI_CFG_GUARD_FREE_INSTANCES
+#define RTTI_CFG_GUARD_FREE_INSTANCES 0
+#endif
+
+#ifndef RTTI_CFG_LAZY_TYPE_REGISTRATION
+#define RTTI_CFG_LAZY_TYPE_REGISTRATION 0
+#endif
+
+#ifndef RTTI_CFG_REGISTRATION_PROFILER
+#define RTTI_CFG_REGISTRATION_PROFILER 0
+#endif
+
 #pragma region Includes
 #include <vector>
 #include <unordered_map>
@@ -64,25 +80,44 @@
 #include <string>
 #include <array>
 #include <functional>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+#include <new>
+#include <cstring>
+#include <string_view>
+#include <charconv>
+#include <limits>
+#include <bit>
+#include <tuple>
+#include <span>
+#include <deque>
+#include <unordered_set>
+#include <cassert>
 #include <stdint.h>
 
 #if RTTI_CFG_CREATE_STD_PAIR_TYPE || RTTI_CFG_CREATE_STD_MAP_TYPE
 #include <utility>
 #endif
 
-#if RTTI_CFG_CREATE_STD_SET_TYPE
-#include <unordered_set>
-#endif
-
 #if RTTI_CFG_CREATE_STD_MAP_TYPE
 #include <unordered_map>
 #endif
+
+#if RTTI_CFG_REGISTRATION_PROFILER
+#include <fstream>
+#endif
 #pragma endregion
 
 #pragma region ForwardDeclarations
 namespace rtti
 {
 	using uint64 = unsigned __int64;
+	using int64 = __int64;
 
 	class Type;
 	template< class T, class T2 = void > class PointerType;
@@ -96,13 +131,36 @@ namespace rtti
 	template< class T > class RuntimeType;
 	template< class T > class EnumType;
 	class StringType;
+	struct MemoryStats;
 	using ID = uint64;
 
 	namespace internal
 	{
 		template< class T1, class T2 > class PairType;
+		class TypePlan;
+		class Delta;
+	}
+
+#if RTTI_CFG_CHANGE_TRACKING
+	class Property;
+
+	namespace internal
+	{
+		inline void OnPropertyChanged( void* owner, const Property& property );
+		inline void OnObjectChanged( void* address );
+		inline void OnContainerChanged( void* containerAddress );
+		inline void OnObjectDestroyed( void* address );
 	}
+#endif
 }
+
+#if RTTI_CFG_CHANGE_TRACKING
+#define RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress ) ::rtti::internal::OnContainerChanged( containerAddress );
+#define RTTI_INTERNAL_ON_OBJECT_DESTROYED( address ) ::rtti::internal::OnObjectDestroyed( address );
+#else
+#define RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
+#define RTTI_INTERNAL_ON_OBJECT_DESTROYED( address )
+#endif
 #pragma endregion
 
 #pragma region VisitOutcome
@@ -307,9 +365,9 @@ namespace rtti
 	namespace internal
 	{
 		// Java's hashCode for String
-		static constexpr uint64 CalcHash( const char* name, uint64 seed = 0u )
+		static constexpr uint64 CalcHash( std::string_view name, uint64 seed = 0u )
 		{
-			for ( uint64 i = 0u; name[ i ] != 0; ++i )
+			for ( uint64 i = 0u; i < name.size(); ++i )
 			{
 				seed = name[ i ] + seed * 31;
 			}
@@ -332,6 +390,100 @@ namespace rtti
 			static constexpr bool value = sizeof( Test<T>( 0 ) ) == sizeof( yes );
 		};
 
+		struct InternedName
+		{
+			// Null terminated, valid for the lifetime of the program.
+			std::string_view m_name;
+			ID m_hash = 0u;
+		};
+
+		// Append only, keeps a single copy of every added name with its hash for the lifetime of the program.
+		class NamePool
+		{
+		public:
+			static NamePool& Get()
+			{
+				static NamePool s_pool;
+				return s_pool;
+			}
+
+			InternedName Intern( std::string_view name )
+			{
+				std::lock_guard< std::mutex > lock( m_mutex );
+				return InternInternal( name );
+			}
+
+			bool Find( std::string_view name, InternedName& outName ) const
+			{
+				std::lock_guard< std::mutex > lock( m_mutex );
+				auto found = m_lookup.find( name );
+				if ( found != m_lookup.end() )
+				{
+					outName = { found->first, found->second };
+					return true;
+				}
+
+				return false;
+			}
+
+			// Caches names built from keys, e.g. names of internal type descs, so they are built only once.
+			template< class TBuildFunc >
+			InternedName InternBuilt( uint64 key, const TBuildFunc& buildFunc )
+			{
+				{
+					std::lock_guard< std::mutex > lock( m_mutex );
+					auto found = m_builtNames.find( key );
+					if ( found != m_builtNames.end() )
+					{
+						return found->second;
+					}
+				}
+
+				// Building might need other names, so it can't hold the lock.
+				const std::string name = buildFunc();
+
+				std::lock_guard< std::mutex > lock( m_mutex );
+				const InternedName interned = InternInternal( name );
+				m_builtNames.emplace( key, interned );
+				return interned;
+			}
+
+			size_t GetMemoryUsage() const
+			{
+				std::lock_guard< std::mutex > lock( m_mutex );
+				size_t bytes = m_lookup.bucket_count() * sizeof( void* ) + m_lookup.size() * ( sizeof( std::pair< const std::string_view, ID > ) + sizeof( void* ) );
+				bytes += m_builtNames.bucket_count() * sizeof( void* ) + m_builtNames.size() * ( sizeof( std::pair< const uint64, InternedName > ) + sizeof( void* ) );
+				for ( const std::string& name : m_names )
+				{
+					bytes += sizeof( std::string ) + ( name.capacity() > s_localCapacity ? name.capacity() + 1u : 0u );
+				}
+
+				return bytes;
+			}
+
+		private:
+			InternedName InternInternal( std::string_view name )
+			{
+				auto found = m_lookup.find( name );
+				if ( found != m_lookup.end() )
+				{
+					return { found->first, found->second };
+				}
+
+				const std::string& storedName = m_names.emplace_back( name );
+				const InternedName interned = { storedName, CalcHash( name ) };
+				m_lookup.emplace( interned.m_name, interned.m_hash );
+				return interned;
+			}
+
+			static inline const size_t s_localCapacity = std::string().capacity();
+
+			mutable std::mutex m_mutex;
+			std::deque< std::string > m_names;
+			std::unordered_map< std::string_view, ID > m_lookup;
+			std::unordered_map< uint64, InternedName > m_builtNames;
+		};
+
 		static constexpr std::pair< size_t, size_t > GetStringStartAndSizeWithoutQuotations( const char* c, size_t size )
 		{
 			return { c[ 0 ] == '\"' ? 1 : 0, c[ size - 2 ] == '\"' ? size - 3 : size - 1 };
@@ -388,22 +540,242 @@ namespace rtti
 }
 #pragma endregion
 
-#pragma region RTTIClass
+#pragma region RegistrationProfiler
 namespace rtti
 {
-	class RTTI
+#if RTTI_CFG_REGISTRATION_PROFILER
+	namespace internal
+	{
+		class RegistrationProfileScope;
+	}
+
+	struct TypeRegistrationRecord
+	{
+		std::string m_name;
+		ID m_id = 0u;
+
+		// Sequential index of the registering thread.
+		uint64 m_threadId = 0u;
+
+		// Nanoseconds since the first recorded registration. Registrations of types registered by this one are nested inside.
+		uint64 m_start = 0u;
+		uint64 m_end = 0u;
+		uint64 m_onRegisteredStart = 0u;
+		uint64 m_onRegisteredEnd = 0u;
+
+		// Including allocations of nested registrations. Counted only if the application forwards its allocations to RegistrationProfiler::RecordAllocation().
+		uint64 m_allocationsAmount = 0u;
+		uint64 m_allocatedBytes = 0u;
+
+		// In the lazy mode members of declared types are registered on the first query, in a separate record of the type.
+		// Its OnRegistered span measures RegisterMembers.
+		bool m_isMembersRegistration = false;
+	};
+
+	class RegistrationProfiler
 	{
 	public:
-		std::vector< const Type* > GetTypes() const
+		static RegistrationProfiler& Get()
+		{
+			static RegistrationProfiler s_profiler;
+			return s_profiler;
+		}
+
+		// Meant to be called from the application's operator new.
+		static void RecordAllocation( size_t bytes )
+		{
+			AllocationCounters& counters = GetAllocationCounters();
+			if ( !counters.m_suspended )
+			{
+				++counters.m_amount;
+				counters.m_bytes += bytes;
+			}
+		}
+
+		std::vector< TypeRegistrationRecord > GetRecords() const
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			return m_records;
+		}
+
+		void Clear()
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			m_records.clear();
+		}
+
+		// Chrome trace event format, can be opened in chrome://tracing or Perfetto.
+		void WriteChromeTrace( std::string& outJson ) const
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+
+			const auto appendEvent = [ &outJson ]( const std::string& name, const char* category, uint64 threadId, uint64 start, uint64 end )
+			{
+				outJson += outJson.back() == '[' ? "\n" : ",\n";
+				outJson += "{\"name\":\"";
+				for ( char c : name )
+				{
+					if ( c == '\"' || c == '\\' )
+					{
+						outJson += '\\';
+					}
+					outJson += c;
+				}
+				outJson += "\",\"cat\":\"";
+				outJson += category;
+				outJson += "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string( threadId );
+				outJson += ",\"ts\":" + std::to_string( start / 1000u ) + "." + std::to_string( start % 1000u / 100u );
+				outJson += ",\"dur\":" + std::to_string( ( end - start ) / 1000u ) + "." + std::to_string( ( end - start ) % 1000u / 100u );
+			};
+
+			outJson += "{\"traceEvents\":[";
+			for ( const TypeRegistrationRecord& record : m_records )
+			{
+				appendEvent( record.m_name, "Registration", record.m_threadId, record.m_start, record.m_end );
+				outJson += ",\"args\":{\"id\":" + std::to_string( record.m_id );
+				outJson += ",\"allocations\":" + std::to_string( record.m_allocationsAmount );
+				outJson += ",\"allocatedBytes\":" + std::to_string( record.m_allocatedBytes ) + "}}";
+
+				appendEvent( record.m_name, record.m_isMembersRegistration ? "RegisterMembers" : "OnRegistered", record.m_threadId, record.m_onRegisteredStart, record.m_onRegisteredEnd );
+				outJson += "}";
+			}
+			outJson += "\n],\"displayTimeUnit\":\"ns\"}\n";
+		}
+
+		bool DumpChromeTrace( const char* path ) const
+		{
+			std::string json;
+			WriteChromeTrace( json );
+
+			std::ofstream file( path, std::ios::binary | std::ios::trunc );
+			file.write( json.data(), static_cast< std::streamsize >( json.size() ) );
+			return file.good();
+		}
+
+	private:
+		friend class internal::RegistrationProfileScope;
+
+		struct AllocationCounters
+		{
+			uint64 m_amount = 0u;
+			uint64 m_bytes = 0u;
+			bool m_suspended = false;
+		};
+
+		static AllocationCounters& GetAllocationCounters()
+		{
+			static thread_local AllocationCounters s_counters;
+			return s_counters;
+		}
+
+		static uint64 GetThreadId()
+		{
+			static std::atomic< uint64 > s_threadsAmount = 0u;
+			static thread_local uint64 s_threadId = ++s_threadsAmount;
+			return s_threadId;
+		}
+
+		uint64 GetTimestamp() const
+		{
+			return static_cast< uint64 >( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_startTime ).count() );
+		}
+
+		void AddRecord( TypeRegistrationRecord&& record )
+		{
+			AllocationCounters& counters = GetAllocationCounters();
+			counters.m_suspended = true;
+			{
+				std::lock_guard< std::mutex > lock( m_mutex );
+				m_records.emplace_back( std::move( record ) );
+			}
+			counters.m_suspended = false;
+		}
+
+		const std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+		mutable std::mutex m_mutex;
+
+		// In the order of finishing registrations, so nested types come before types that registered them.
+		std::vector< TypeRegistrationRecord > m_records;
+	};
+
+	namespace internal
+	{
+		class RegistrationProfileScope
 		{
-			std::vector< const Type* > types;
-			types.reserve( m_types.size() );
-			for ( const auto& type : m_types )
+		public:
+			RegistrationProfileScope()
+				: m_profiler( RegistrationProfiler::Get() )
+			{
+				const auto& counters = RegistrationProfiler::GetAllocationCounters();
+				m_record.m_allocationsAmount = counters.m_amount;
+				m_record.m_allocatedBytes = counters.m_bytes;
+				m_record.m_start = m_profiler.GetTimestamp();
+			}
+
+			void OnRegisteredStarted()
+			{
+				m_record.m_onRegisteredStart = m_profiler.GetTimestamp();
+			}
+
+			void OnRegisteredFinished()
+			{
+				m_record.m_onRegisteredEnd = m_profiler.GetTimestamp();
+			}
+
+			void Finish( const char* name, ID id, bool isMembersRegistration = false )
 			{
-				types.emplace_back( type.get() );
+				m_record.m_end = m_profiler.GetTimestamp();
+				m_record.m_name = name;
+				m_record.m_id = id;
+				m_record.m_isMembersRegistration = isMembersRegistration;
+				m_record.m_threadId = RegistrationProfiler::GetThreadId();
+
+				const auto& counters = RegistrationProfiler::GetAllocationCounters();
+				m_record.m_allocationsAmount = counters.m_amount - m_record.m_allocationsAmount;
+				m_record.m_allocatedBytes = counters.m_bytes - m_record.m_allocatedBytes;
+				m_profiler.AddRecord( std::move( m_record ) );
 			}
 
-			return types;
+		private:
+			RegistrationProfiler& m_profiler;
+			TypeRegistrationRecord m_record;
+		};
+	}
+#else
+	namespace internal
+	{
+		class RegistrationProfileScope
+		{
+		public:
+			void OnRegisteredStarted() {}
+			void OnRegisteredFinished() {}
+			void Finish( const char*, ID, bool = false ) {}
+		};
+	}
+#endif
+}
+#pragma endregion
+
+#pragma region RTTIClass
+namespace rtti
+{
+	namespace internal
+	{
+		// Zero initialized memory for the only instance of a type class created without arguments, so registering it doesn't allocate.
+		template< class T >
+		struct StaticTypeStorage
+		{
+			alignas( T ) static inline unsigned char s_memory[ sizeof( T ) ];
+			static inline T* s_instance = nullptr;
+		};
+	}
+
+	class RTTI
+	{
+	public:
+		std::vector< const Type* > GetTypes() const
+		{
+			return std::vector< const Type* >( m_types.begin(), m_types.end() );
 		}
 
 		template< class TFunc >
@@ -446,32 +818,50 @@ namespace rtti
 				return static_cast< T& >( *found->second );
 			}
 
-			T* instance = new T( std::forward< const TArgs& >( args )... );
+			internal::RegistrationProfileScope profileScope;
+			T* instance = CreateTypeInstance< T >( args... );
 			m_types.emplace_back( instance );
+			m_typeObjectSizes.emplace_back( sizeof( T ) );
 			m_typesLUT.emplace( id, instance );
 
+			profileScope.OnRegisteredStarted();
 			instance->OnRegistered();
+			profileScope.OnRegisteredFinished();
 
+			profileScope.Finish( instance->GetName(), id );
 			return *instance;
 		}
 
 		template< class T, class... TArgs, std::enable_if_t< !internal::has_CalcId< T >::value, bool > = true >
 		T& GetOrRegisterType( const TArgs& ... args )
 		{
-			std::unique_ptr< T > instance( new T( std::forward< const TArgs& >( args )... ) );
+			if constexpr ( sizeof...( TArgs ) == 0u )
+			{
+				if ( T* instance = internal::StaticTypeStorage< T >::s_instance )
+				{
+					return *instance;
+				}
+			}
 
+			internal::RegistrationProfileScope profileScope;
+			T* instance = CreateTypeInstance< T >( args... );
 			auto currentInstance = m_typesLUT.find( instance->GetID() );
 
 			if ( currentInstance == m_typesLUT.end() )
 			{
-				T& result = *instance;
-				m_typesLUT.emplace( instance->GetID(), instance.get() );
-				m_types.emplace_back( std::move( instance ) );
+				m_typesLUT.emplace( instance->GetID(), instance );
+				m_types.emplace_back( instance );
+				m_typeObjectSizes.emplace_back( sizeof( T ) );
 
-				result.OnRegistered();
-				return result;
+				profileScope.OnRegisteredStarted();
+				instance->OnRegistered();
+				profileScope.OnRegisteredFinished();
+
+				profileScope.Finish( instance->GetName(), instance->GetID() );
+				return *instance;
 			}
 
+			DestroyTypeInstance< T, TArgs... >( instance );
 			return static_cast< T& >( *currentInstance->second );
 		}
 
@@ -488,25 +878,129 @@ namespace rtti
 
 		const Type* FindType( const char* name ) const
 		{
-			ID id = internal::CalcHash( name );
-			return FindType( id );
+			return FindType( std::string_view( name ) );
+		}
+
+		const Type* FindType( std::string_view name ) const
+		{
+			return FindType( internal::CalcHash( name ) );
 		}
 
+		// Uses the precomputed hash.
+		const Type* FindType( const internal::InternedName& name ) const
+		{
+			return FindType( name.m_hash );
+		}
+
+		// Estimated memory used by the registry and all registered types.
+		MemoryStats GetMemoryStats() const;
+
 	private:
+		template< class T, class... TArgs >
+		T* CreateTypeInstance( const TArgs& ... args )
+		{
+			if constexpr ( sizeof...( TArgs ) == 0u )
+			{
+				using Storage = internal::StaticTypeStorage< T >;
+				Storage::s_instance = new ( Storage::s_memory ) T();
+				m_staticTypes.emplace_back( Storage::s_instance );
+				return Storage::s_instance;
+			}
+			else
+			{
+				T* instance = new T( std::forward< const TArgs& >( args )... );
+				m_ownedTypes.emplace_back( instance );
+				return instance;
+			}
+		}
+
+		// Constructing a type might register other types, so the instance isn't necessarily the last one.
+		template< class T, class... TArgs >
+		void DestroyTypeInstance( T* instance )
+		{
+			if constexpr ( sizeof...( TArgs ) == 0u )
+			{
+				m_staticTypes.erase( std::find( m_staticTypes.begin(), m_staticTypes.end(), instance ) );
+				instance->~T();
+				internal::StaticTypeStorage< T >::s_instance = nullptr;
+			}
+			else
+			{
+				m_ownedTypes.erase( std::find_if( m_ownedTypes.begin(), m_ownedTypes.end(), [ & ]( const auto& owned ) { return owned.get() == instance; } ) );
+			}
+		}
+
 		std::unordered_map< ID, Type* > m_typesLUT;
-		std::vector< std::unique_ptr< Type > > m_types;
+
+		// In the order of registration.
+		std::vector< Type* > m_types;
+
+		// Sizes of objects in m_types.
+		std::vector< size_t > m_typeObjectSizes;
+
+		// Created with arguments (e.g. runtime types), other types live in StaticTypeStorage.
+		// Static ones are never destroyed, so pointers to them stay valid during the whole shutdown.
+		std::vector< std::unique_ptr< Type > > m_ownedTypes;
+		std::vector< Type* > m_staticTypes;
 	};
 
 	static auto Get = RTTI::Get;
+
+	namespace internal
+	{
+#if RTTI_CFG_GUARD_FREE_INSTANCES
+		// Constant initialized, so reading it doesn't go through the guard of a function local static.
+		template< class T >
+		struct TypeInstanceSlot
+		{
+			static constinit inline std::atomic< const T* > s_instance = nullptr;
+			static constinit inline std::once_flag s_registrationFlag;
+		};
+#endif
+
+		// Registers the type on the first call, unless it's already registered (e.g. by RTTI_IMPLEMENT_TYPE during static initialization).
+		template< class T >
+		const T& GetOrRegisterTypeInstance()
+		{
+#if RTTI_CFG_GUARD_FREE_INSTANCES
+			const T* instance = TypeInstanceSlot< T >::s_instance.load( std::memory_order_acquire );
+			if ( !instance ) [[unlikely]]
+			{
+				// Serializes first accesses of the type, like the guard of a function local static does.
+				std::call_once( TypeInstanceSlot< T >::s_registrationFlag, []()
+					{
+						TypeInstanceSlot< T >::s_instance.store( &::rtti::RTTI::GetMutable().GetOrRegisterType< T >(), std::memory_order_release );
+					} );
+				instance = TypeInstanceSlot< T >::s_instance.load( std::memory_order_acquire );
+			}
+
+			return *instance;
+#else
+			static const T& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< T >();
+			return s_typeInstance;
+#endif
+		}
+	}
 }
 #pragma endregion
 
 #pragma region Properties
 namespace rtti
 {
+	namespace internal
+	{
+		// Allocated only for properties with metadata, so others only pay for a null pointer.
+		using PropertyMetadata = std::unordered_map< std::string, std::string >;
+
+		template< class T, class TIndices >
+		class StaticPropertiesTable;
+	}
+
 	class Property
 	{
 		friend class Type;
+		template< class T, class TIndices >
+		friend class internal::StaticPropertiesTable;
 
 	public:
 
@@ -551,11 +1045,14 @@ namespace rtti
 		void SetValue( void* owner, const T& value ) const
 		{
 			GetValue< T >( owner ) = value;
+#if RTTI_CFG_CHANGE_TRACKING
+			internal::OnPropertyChanged( owner, *this );
+#endif
 		}
 
 		const Type& GetType() const
 		{
-			return m_type;
+			return *m_type;
 		}
 
 		bool HasFlags( InstanceFlags flags ) const
@@ -570,13 +1067,18 @@ namespace rtti
 
 		bool HasMetadata( const std::string& key ) const
 		{
-			return m_metadata.contains( key );
+			return m_metadata && m_metadata->contains( key );
 		}
 
 		const std::string* GetMetadataValue( const std::string& key ) const
 		{
-			auto found = m_metadata.find( key );
-			if ( found != m_metadata.end() )
+			if ( !m_metadata )
+			{
+				return nullptr;
+			}
+
+			auto found = m_metadata->find( key );
+			if ( found != m_metadata->end() )
 			{
 				return found->second.empty() ? nullptr : &found->second;
 			}
@@ -586,46 +1088,74 @@ namespace rtti
 
 		void TryToAddMetadata( std::string key, std::string value )
 		{
-			if ( m_metadata.find( key ) == m_metadata.end() )
+			if ( !m_metadata )
 			{
-				m_metadata.emplace( std::move( key ), std::move( value ) );
+				m_metadata = std::make_unique< internal::PropertyMetadata >();
+			}
+
+			if ( m_metadata->find( key ) == m_metadata->end() )
+			{
+				m_metadata->emplace( std::move( key ), std::move( value ) );
 			}
 		}
 
 		size_t GetContainerIndex() const
 		{
-			return m_containerIndex;
+			return m_containerIndex == c_noContainerIndex ? static_cast< size_t >( -1 ) : m_containerIndex;
 		}
 
 	private:
+		static constexpr uint32_t c_noContainerIndex = std::numeric_limits< uint32_t >::max();
+
 		Property( const char* name, size_t containerIndex, size_t offset, const Type& type, InstanceFlags flags )
 			: m_name( name )
 			, m_id( internal::CalcHash( name ) )
-			, m_offset( offset )
-			, m_type( type )
-			, m_containerIndex( containerIndex )
+			, m_type( &type )
+			, m_offset( static_cast< uint32_t >( offset ) )
+			, m_containerIndex( containerIndex == static_cast< size_t >( -1 ) ? c_noContainerIndex : static_cast< uint32_t >( containerIndex ) )
 			, m_instanceFlags( flags )
-		{}
+		{
+			assert( offset < std::numeric_limits< uint32_t >::max() && "Property's offset doesn't fit into 32 bits." );
+			assert( ( containerIndex == static_cast< size_t >( -1 ) || containerIndex < c_noContainerIndex ) && "Container index doesn't fit into 32 bits." );
+		}
+
+		// Used for constant initialized tables, the type is linked at registration.
+		constexpr Property( const char* name, ID id, size_t offset, InstanceFlags flags )
+			: m_name( name )
+			, m_id( id )
+			, m_offset( static_cast< uint32_t >( offset ) )
+			, m_instanceFlags( flags )
+		{
+			assert( offset < std::numeric_limits< uint32_t >::max() && "Property's offset doesn't fit into 32 bits." );
+		}
 
+	public:
+		// Properties own their metadata, so they are only moved.
+		Property( const Property& ) = delete;
+		Property( Property&& ) = default;
+
+	private:
 		const char* m_name = nullptr;
 		ID m_id = 0u;
-		size_t m_offset = 0u;
-		const Type& m_type;
-		size_t m_containerIndex = static_cast< size_t >( -1 );
+		const Type* m_type = nullptr;
+		std::unique_ptr< internal::PropertyMetadata > m_metadata;
+		uint32_t m_offset = 0u;
+		uint32_t m_containerIndex = c_noContainerIndex;
 		InstanceFlags m_instanceFlags = InstanceFlags::None;
-		std::unordered_map< std::string, std::string > m_metadata;
 	};
 }
 
-#define RTTI_REGISTER_PROPERTY( PropertyName, ... ) TryToAddProperty( CreateProperty< decltype( CurrentlyImplementedType::##PropertyName ) >( #PropertyName, static_cast< size_t >( -1 ), offsetof( CurrentlyImplementedType, PropertyName ), \
- []( ::rtti::Property& prop ) \
+#define RTTI_INTERNAL_PROPERTY_INIT_FUNC( ... ) []( ::rtti::Property& prop ) \
 	{ \
 		auto TryToAddMetadata = [ & ]( const std::string& key, const std::string& value ) \
 		{ \
 			prop.TryToAddMetadata( key, value ); \
 		}; \
 		__VA_ARGS__ \
-	} ) );
+	}
+
+#define RTTI_REGISTER_PROPERTY( PropertyName, ... ) TryToAddProperty( CreateProperty< decltype( CurrentlyImplementedType::##PropertyName ) >( #PropertyName, static_cast< size_t >( -1 ), offsetof( CurrentlyImplementedType, PropertyName ) ), \
+	RTTI_INTERNAL_PROPERTY_INIT_FUNC( __VA_ARGS__ ) );
 #pragma endregion
 
 #pragma region InternalTypeDesc
@@ -644,13 +1174,8 @@ namespace rtti
 			return m_type;
 		}
 
-		std::string ConstructName() const
-		{
-			std::string name;
-			AppendName( name );
-
-			return name;
-		}
+		// Interned, built only on the first call for the given type and flags.
+		std::string_view ConstructName() const;
 
 		void AppendName( std::string& destination ) const;
 
@@ -774,6 +1299,17 @@ namespace rtti
 		void Call( void* obj, void* args, void* ret ) const
 		{
 			m_func( obj, args, ret );
+#if RTTI_CFG_CHANGE_TRACKING
+			if ( !m_isConst )
+			{
+				internal::OnObjectChanged( obj );
+			}
+#endif
+		}
+
+		bool IsConst() const
+		{
+			return m_isConst;
 		}
 
 		ID GetID() const
@@ -790,7 +1326,7 @@ namespace rtti
 		{
 			for ( const ParameterTypeDesc typeDesc : m_parameterTypeDescs )
 			{
-				m_id = internal::CalcHash( typeDesc.ConstructName().c_str(), m_id );
+				m_id = internal::CalcHash( typeDesc.ConstructName(), m_id );
 			}
 
 			m_id = internal::CalcHash( m_name, m_id );
@@ -807,6 +1343,10 @@ namespace rtti
 		const char* m_name = nullptr;
 		InternalFuncType m_func;
 		ID m_id = 0u;
+		bool m_isConst = false;
+
+		// Estimated, callables bigger than internal::c_functionLocalStorageSize don't fit into the local storage of std::function.
+		uint32_t m_callableHeapBytes = 0u;
 	};
 
 
@@ -817,6 +1357,79 @@ namespace rtti
 #pragma region TypeClass
 namespace rtti
 {
+	// Heap allocations are estimated from sizes and capacities of containers.
+	struct TypeMemoryStats
+	{
+		size_t m_typeObjectBytes = 0u;
+
+		// Property records, including member records of enums.
+		size_t m_propertiesBytes = 0u;
+
+		// Function records with their parameters and callables.
+		size_t m_methodsBytes = 0u;
+
+		// Metadata of types and their properties.
+		size_t m_metadataBytes = 0u;
+
+		// Names owned by the type or stored for it in the name pool.
+		size_t m_namesBytes = 0u;
+
+		size_t GetTotalBytes() const
+		{
+			return m_typeObjectBytes + m_propertiesBytes + m_methodsBytes + m_metadataBytes + m_namesBytes;
+		}
+
+		TypeMemoryStats& operator+=( const TypeMemoryStats& rhl )
+		{
+			m_typeObjectBytes += rhl.m_typeObjectBytes;
+			m_propertiesBytes += rhl.m_propertiesBytes;
+			m_methodsBytes += rhl.m_methodsBytes;
+			m_metadataBytes += rhl.m_metadataBytes;
+			m_namesBytes += rhl.m_namesBytes;
+			return *this;
+		}
+	};
+
+	namespace internal
+	{
+		// Biggest callable stored inside std::function without allocating, it differs between standard libraries.
+#if defined( _MSVC_STL_VERSION )
+		inline constexpr size_t c_functionLocalStorageSize = ( 6u + 16u / sizeof( void* ) - 1u ) * sizeof( void* );
+#elif defined( _LIBCPP_VERSION )
+		inline constexpr size_t c_functionLocalStorageSize = 3u * sizeof( void* );
+#else
+		inline constexpr size_t c_functionLocalStorageSize = 2u * sizeof( void* );
+#endif
+
+		template< class T >
+		size_t GetHeapMemoryUsage( const std::vector< T >& vec )
+		{
+			return vec.capacity() * sizeof( T );
+		}
+
+		inline size_t GetHeapMemoryUsage( const std::string& str )
+		{
+			static const size_t s_localCapacity = std::string().capacity();
+			return str.capacity() > s_localCapacity ? str.capacity() + 1u : 0u;
+		}
+
+		template< class TKey, class TValue >
+		size_t GetHeapMemoryUsage( const std::unordered_map< TKey, TValue >& map )
+		{
+			// Nodes keep a pointer to the next node and a cached hash.
+			size_t bytes = map.bucket_count() * sizeof( void* ) + map.size() * ( sizeof( typename std::unordered_map< TKey, TValue >::value_type ) + 2u * sizeof( void* ) );
+			if constexpr ( std::is_same_v< TKey, std::string > && std::is_same_v< TValue, std::string > )
+			{
+				for ( const auto& [ key, value ] : map )
+				{
+					bytes += GetHeapMemoryUsage( key ) + GetHeapMemoryUsage( value );
+				}
+			}
+
+			return bytes;
+		}
+	}
+
 	class Type
 	{
 	public:
@@ -875,7 +1488,7 @@ namespace rtti
 		}
 
 		template< class T >
-		static bool InheritsFromStatic()
+		static constexpr bool InheritsFromStatic()
 		{
 			return false;
 		}
@@ -927,6 +1540,12 @@ namespace rtti
 			return false;
 		}
 
+		// False for runtime types between BeginLayout() and FinalizeLayout().
+		virtual bool IsLayoutFinalized() const
+		{
+			return true;
+		}
+
 		ID GetID() const
 		{
 			return m_id;
@@ -987,6 +1606,14 @@ namespace rtti
 			return nullptr;
 		}
 
+		// Fingerprint of the memory layout built recursively from kinds, sizes, alignments and properties' IDs and offsets.
+		// Matching hashes mean that byte images of the type might be copied directly.
+		// Cached, except for runtime types. Only they can change after registration and only they can embed other runtime types.
+		uint64 GetLayoutHash() const;
+
+		// Adds memory allocated by members of the type object, size of the object itself is known only to the RTTI.
+		virtual void CollectMemoryStats( TypeMemoryStats& stats ) const {}
+
 	protected:
 		Type( const char* name )
 			: Type( internal::CalcHash( name ) )
@@ -998,6 +1625,37 @@ namespace rtti
 
 		virtual void OnRegistered() {}
 
+		static void CollectPropertiesMemoryStats( const std::vector< ::rtti::Property >& properties, TypeMemoryStats& stats )
+		{
+			stats.m_propertiesBytes += internal::GetHeapMemoryUsage( properties );
+			CollectMetadataMemoryStats( properties, stats );
+		}
+
+		// Properties linked from static tables.
+		static void CollectPropertiesMemoryStats( std::span< const ::rtti::Property > properties, TypeMemoryStats& stats )
+		{
+			stats.m_propertiesBytes += properties.size_bytes();
+			CollectMetadataMemoryStats( properties, stats );
+		}
+
+		static void CollectMetadataMemoryStats( std::span< const ::rtti::Property > properties, TypeMemoryStats& stats )
+		{
+			for ( const ::rtti::Property& property : properties )
+			{
+				stats.m_metadataBytes += property.m_metadata ? sizeof( internal::PropertyMetadata ) + internal::GetHeapMemoryUsage( *property.m_metadata ) : 0u;
+			}
+		}
+
+		static void CollectMethodsMemoryStats( const std::vector< ::rtti::Function >& methods, TypeMemoryStats& stats )
+		{
+			stats.m_methodsBytes += internal::GetHeapMemoryUsage( methods );
+			for ( const ::rtti::Function& method : methods )
+			{
+				stats.m_methodsBytes += internal::GetHeapMemoryUsage( method.m_parameterTypeDescs ) + method.m_callableHeapBytes;
+				stats.m_methodsBytes += method.m_returnTypeDesc ? sizeof( ParameterTypeDesc ) : 0u;
+			}
+		}
+
 		static ::rtti::Property CreateProperty( const char* name, size_t containerIndex, size_t offset, const Type& type, InstanceFlags flags )
 		{
 			return ::rtti::Property( name, containerIndex, offset, type, flags );
@@ -1011,12 +1669,20 @@ namespace rtti
 			return property;
 		}
 
-		template< class T, class TInitFunc >
-		static ::rtti::Property CreateProperty( const char* name, size_t containerIndex, size_t offset, TInitFunc initFunc )
+		template< class T >
+		static ::rtti::Property CreateProperty( const char* name, size_t containerIndex, size_t offset )
 		{
 			static_assert( !std::is_reference_v< T >, "Reference properties are not supported!" );
 			static_assert( !std::is_const_v< T >, "Const properties are not supported!" );
-			return CreateProperty( name, containerIndex, offset, GetTypeInstanceOf< T >(), GetInstanceFlags< T >(), std::move( initFunc ) );
+			return CreateProperty( name, containerIndex, offset, GetTypeInstanceOf< T >(), GetInstanceFlags< T >() );
+		}
+
+		template< class T, class TInitFunc >
+		static ::rtti::Property CreateProperty( const char* name, size_t containerIndex, size_t offset, TInitFunc initFunc )
+		{
+			auto property = CreateProperty< T >( name, containerIndex, offset );
+			initFunc( property );
+			return property;
 		}
 
 		template< class T >
@@ -1044,19 +1710,64 @@ namespace rtti
 					MethodSignature::Call( nonConstFuncPtr, obj, args, ret );
 				};
 
-			if ( MethodSignature::GetReturnTypeDesc() )
-			{
-				return ::rtti::Function( name, *MethodSignature::GetReturnTypeDesc(), MethodSignature::GetReturnTypeDescInstanceFlags(), std::move( parameterTypes ), std::move( func ) );
-			}
-			else
-			{
-				return ::rtti::Function( name, std::move( parameterTypes ), std::move( func ) );
-			}
-			
+			::rtti::Function function = MethodSignature::GetReturnTypeDesc()
+				? ::rtti::Function( name, *MethodSignature::GetReturnTypeDesc(), MethodSignature::GetReturnTypeDescInstanceFlags(), std::move( parameterTypes ), std::move( func ) )
+				: ::rtti::Function( name, std::move( parameterTypes ), std::move( func ) );
+			function.m_isConst = !std::is_same_v< TFunc, TNonConstFunc >;
+			function.m_callableHeapBytes = sizeof( func ) > internal::c_functionLocalStorageSize ? static_cast< uint32_t >( sizeof( func ) ) : 0u;
+			return function;
 		}
 	private:
+		friend class internal::TypePlan;
+
+		uint64 CalcLayoutHash( std::vector< const Type* >& stack ) const;
+
 		ID m_id = 0u;
+		mutable std::atomic< uint64 > m_layoutHash = 0u;
+		// Published only after it's fully compiled.
+		mutable std::atomic< const internal::TypePlan* > m_plan = nullptr;
+	};
+
+	struct MemoryStats
+	{
+		TypeMemoryStats m_total;
+		std::unordered_map< Type::Kind, TypeMemoryStats > m_perKind;
+
+		// In the order of registration.
+		std::vector< std::pair< const Type*, TypeMemoryStats > > m_perType;
+
+		// Lookup table and lists of the registry itself, not included in m_total.
+		size_t m_registryBytes = 0u;
+
+		// Whole name pool, shared with names of properties and internal type descs.
+		size_t m_namePoolBytes = 0u;
+
+		size_t GetTotalBytes() const
+		{
+			return m_total.GetTotalBytes() + m_registryBytes;
+		}
 	};
+
+	inline MemoryStats RTTI::GetMemoryStats() const
+	{
+		MemoryStats stats;
+		stats.m_perType.reserve( m_types.size() );
+		for ( size_t i = 0u; i < m_types.size(); ++i )
+		{
+			TypeMemoryStats typeStats;
+			typeStats.m_typeObjectBytes = m_typeObjectSizes[ i ];
+			m_types[ i ]->CollectMemoryStats( typeStats );
+
+			stats.m_total += typeStats;
+			stats.m_perKind[ m_types[ i ]->GetKind() ] += typeStats;
+			stats.m_perType.emplace_back( m_types[ i ], typeStats );
+		}
+
+		stats.m_registryBytes = internal::GetHeapMemoryUsage( m_typesLUT ) + internal::GetHeapMemoryUsage( m_types ) + internal::GetHeapMemoryUsage( m_typeObjectSizes )
+			+ internal::GetHeapMemoryUsage( m_ownedTypes ) + internal::GetHeapMemoryUsage( m_staticTypes );
+		stats.m_namePoolBytes = internal::NamePool::Get().GetMemoryUsage();
+		return stats;
+	}
 }
 #pragma endregion
 
@@ -1093,6 +1804,7 @@ namespace rtti
 
 		virtual void Destroy( void* address ) const override
 		{
+			RTTI_INTERNAL_ON_OBJECT_DESTROYED( address )
 			static_cast< T* >( address )->~T();
 		}
 
@@ -1113,8 +1825,7 @@ namespace rtti
 
 		static const type_of< T >::type& GetInstance()
 		{
-			static const type_of< T >::type& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< type_of< T >::type >();
-			return s_typeInstance;
+			return ::rtti::internal::GetOrRegisterTypeInstance< type_of< T >::type >();
 		}
 
 	protected:
@@ -1128,6 +1839,17 @@ namespace rtti
 #pragma region InternalTypeDescImpl
 namespace rtti
 {
+	inline std::string_view InternalTypeDesc::ConstructName() const
+	{
+		const uint64 key = internal::CalcHash( std::string_view( reinterpret_cast< const char* >( &m_flags ), sizeof( m_flags ) ), GetType().GetID() );
+		return internal::NamePool::Get().InternBuilt( key, [ this ]()
+			{
+				std::string name;
+				AppendName( name );
+				return name;
+			} ).m_name;
+	}
+
 	inline void InternalTypeDesc::AppendName( std::string& destination ) const
 	{
 		destination.reserve( destination.size() + strlen( GetType().GetName() ) );
@@ -1153,7 +1875,7 @@ namespace rtti
 #define RTTI_INTERNAL_VIRTUAL_true virtual
 #define RTTI_INTERNAL_VIRTUAL_false
 
-#define RTTI_INTERNAL_INHERITS_FROM_STATIC_BODY_true return Super::GetTypeStatic().IsA< T >() || Super::InheritsFromStatic< T >();
+#define RTTI_INTERNAL_INHERITS_FROM_STATIC_BODY_true return std::is_same_v< Super, std::remove_cv_t< T > > || Super::template InheritsFromStatic< T >();
 #define RTTI_INTERNAL_INHERITS_FROM_STATIC_BODY_false return false;
 
 #define RTTI_INTERNAL_CONSTRUCT_BODY_true( ClassName ) return nullptr;
@@ -1176,6 +1898,36 @@ namespace rtti
 #define RTTI_INTERNAL_GET_PARENT_true( ParentClassName ) virtual const rtti::Type* GetParent() const override { return &ParentClassName::GetTypeStatic(); }
 #define RTTI_INTERNAL_GET_PARENT_false( ParentClassName ) 
 
+// In the lazy mode the body of RTTI_IMPLEMENT_TYPE runs on the first query of properties, methods or metadata instead of during registration.
+#if RTTI_CFG_LAZY_TYPE_REGISTRATION
+#define RTTI_INTERNAL_MEMBERS_REGISTRATION RegisterMembers
+#define RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() EnsureMembersRegistered();
+// Memory stats skip members which aren't registered yet, so collecting them doesn't register anything.
+#define RTTI_INTERNAL_ARE_MEMBERS_REGISTERED() m_membersRegistered.load( std::memory_order_acquire )
+#define RTTI_INTERNAL_MEMBERS_REGISTRATION_DECLARATIONS \
+		virtual void OnRegistered() override {} \
+		void RegisterMembers(); \
+		void EnsureMembersRegistered() const \
+		{ \
+			std::call_once( m_membersRegistrationFlag, [ this ]() \
+				{ \
+					::rtti::internal::RegistrationProfileScope profileScope; \
+					profileScope.OnRegisteredStarted(); \
+					const_cast< Type* >( this )->RegisterMembers(); \
+					profileScope.OnRegisteredFinished(); \
+					profileScope.Finish( GetName(), GetID(), true ); \
+					m_membersRegistered.store( true, std::memory_order_release ); \
+				} ); \
+		} \
+		mutable std::once_flag m_membersRegistrationFlag; \
+		mutable std::atomic< bool > m_membersRegistered = false;
+#else
+#define RTTI_INTERNAL_MEMBERS_REGISTRATION OnRegistered
+#define RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED()
+#define RTTI_INTERNAL_ARE_MEMBERS_REGISTERED() true
+#define RTTI_INTERNAL_MEMBERS_REGISTRATION_DECLARATIONS virtual void OnRegistered() override;
+#endif
+
 #define RTTI_INTERNAL_DECLARE_TYPE_PARENT( ClassName, ParentClassName, Inherits, Virtual, Abstract, KindName ) \
 using This = ClassName; \
 public: \
@@ -1214,6 +1966,7 @@ public: \
 		RTTI_INTERNAL_MOVE_IN_PLACE_##Abstract##( ClassName ) \
 		virtual void Destroy( void* address ) const override \
 		{ \
+			RTTI_INTERNAL_ON_OBJECT_DESTROYED( address ) \
 			static_cast< ClassName##* >( address )->~##ClassName##(); \
 		} \
 		virtual bool IsAbstract() const override \
@@ -1238,34 +1991,41 @@ public: \
 		} \
 		static const Type& GetInstance() \
 		{ \
-			static const Type& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< Type >(); \
-			return s_typeInstance; \
+			return ::rtti::internal::GetOrRegisterTypeInstance< Type >(); \
 		} \
 		virtual size_t GetPropertiesAmount() const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
-			return (parentTypeInstance ? parentTypeInstance->GetPropertiesAmount() : 0u) + m_properties.size(); \
+			return (parentTypeInstance ? parentTypeInstance->GetPropertiesAmount() : 0u) + m_linkedProperties.size() + m_properties.size(); \
 		} \
 		virtual const ::rtti::Property* GetProperty( size_t index ) const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
 			const size_t inheritedPropertiesAmount = parentTypeInstance ? parentTypeInstance->GetPropertiesAmount() : 0; \
 			if( index < inheritedPropertiesAmount ) \
 			{ \
 				return parentTypeInstance->GetProperty( index ); \
 			} \
+			else if ( index - inheritedPropertiesAmount < m_linkedProperties.size() ) \
+			{ \
+				return &m_linkedProperties[ index - inheritedPropertiesAmount ]; \
+			} \
 			else \
 			{ \
-				return &m_properties[ index - inheritedPropertiesAmount ]; \
+				return &m_properties[ index - inheritedPropertiesAmount - m_linkedProperties.size() ]; \
 			} \
 		} \
 		virtual size_t GetMethodsAmount() const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
 			return ( parentTypeInstance ? parentTypeInstance->GetMethodsAmount() : 0u ) + m_methods.size(); \
 		} \
 		virtual const ::rtti::Function* GetMethod( size_t index ) const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
 			const size_t inheritedMethodsAmount = parentTypeInstance ? parentTypeInstance->GetMethodsAmount() : 0; \
 			if( index < inheritedMethodsAmount ) \
@@ -1277,8 +2037,20 @@ public: \
 				return &m_methods[ index - inheritedMethodsAmount ]; \
 			} \
 		} \
+		virtual void CollectMemoryStats( ::rtti::TypeMemoryStats& stats ) const override \
+		{ \
+			if ( !RTTI_INTERNAL_ARE_MEMBERS_REGISTERED() ) \
+			{ \
+				return; \
+			} \
+			CollectPropertiesMemoryStats( m_properties, stats ); \
+			CollectPropertiesMemoryStats( m_linkedProperties, stats ); \
+			CollectMethodsMemoryStats( m_methods, stats ); \
+			stats.m_metadataBytes += ::rtti::internal::GetHeapMemoryUsage( m_metadata ); \
+		} \
 		virtual bool HasMetadata( const std::string& key ) const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			if ( m_metadata.contains( key ) ) \
 			{ \
 				return true; \
@@ -1288,6 +2060,7 @@ public: \
 		} \
 		virtual const std::string* GetMetadataValue( const std::string& key ) const override \
 		{ \
+			RTTI_INTERNAL_ENSURE_MEMBERS_REGISTERED() \
 			auto found = m_metadata.find( key ); \
 			if ( found != m_metadata.end() ) \
 			{ \
@@ -1299,21 +2072,45 @@ public: \
 	protected: \
 		Type(); \
 		Type( const char* name ) : ParentClassType ( name ) {} \
-		virtual void OnRegistered() override; \
+		RTTI_INTERNAL_MEMBERS_REGISTRATION_DECLARATIONS \
 	private: \
-		void TryToAddProperty( ::rtti::Property&& prop ) \
+		template< class TInitFunc > \
+		void TryToAddProperty( ::rtti::Property&& prop, const TInitFunc& initFunc ) \
 		{ \
-			if ( !FindProperty( prop.GetID() ) ) \
+			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
+			if ( parentTypeInstance && parentTypeInstance->FindProperty( prop.GetID() ) ) \
+			{ \
+				return; \
+			} \
+			for ( const ::rtti::Property& property : m_linkedProperties ) \
+			{ \
+				if ( property.GetID() == prop.GetID() ) \
+				{ \
+					return; \
+				} \
+			} \
+			for ( const ::rtti::Property& property : m_properties ) \
 			{ \
-				m_properties.emplace_back( std::move( prop ) ); \
+				if ( property.GetID() == prop.GetID() ) \
+				{ \
+					return; \
+				} \
 			} \
+			initFunc( m_properties.emplace_back( std::move( prop ) ) ); \
 		} \
 		void TryToAddMethod( ::rtti::Function&& func ) \
 		{ \
-			for ( size_t i = 0; i < GetMethodsAmount(); ++i ) \
+			const auto* parentTypeInstance = ::rtti::internal::TryToGetInstance< ParentClassType >(); \
+			for ( size_t i = 0; parentTypeInstance && i < parentTypeInstance->GetMethodsAmount(); ++i ) \
+			{ \
+				if ( parentTypeInstance->GetMethod( i )->GetID() == func.GetID() ) \
+				{ \
+					return; \
+				} \
+			} \
+			for ( const ::rtti::Function& method : m_methods ) \
 			{ \
-				const ::rtti::Function* method = GetMethod( i ); \
-				if ( method->GetID() == func.GetID() ) \
+				if ( method.GetID() == func.GetID() ) \
 				{ \
 					return; \
 				} \
@@ -1327,6 +2124,7 @@ public: \
 				m_metadata.emplace( std::move( key ), std::move( value ) ); \
 			} \
 		} \
+		std::span< ::rtti::Property > m_linkedProperties; \
 		std::vector< ::rtti::Property > m_properties; \
 		std::vector< ::rtti::Function > m_methods; \
 		std::unordered_map< std::string, std::string > m_metadata; \
@@ -1355,12 +2153,12 @@ public: \
 		return GetTypeStatic(); \
 	} \
 	template< class T > \
-	static bool InheritsFromOrIsAStatic() \
+	static constexpr bool InheritsFromOrIsAStatic() \
 	{ \
-		return GetTypeStatic().IsA< T >() || InheritsFromStatic< T >(); \
+		return std::is_same_v< This, std::remove_cv_t< T > > || InheritsFromStatic< T >(); \
 	} \
 	template< class T > \
-	static bool InheritsFromStatic() \
+	static constexpr bool InheritsFromStatic() \
 	{ \
 		RTTI_INTERNAL_INHERITS_FROM_STATIC_BODY_##Inherits; \
 	} \
@@ -1419,7 +2217,7 @@ static Initializer s_initializer; \
 NamespaceClassName##::Type::Type() : NamespaceClassName##::Type::Type( GetName() ) \
 { \
 } \
-void NamespaceClassName##::Type::OnRegistered() \
+void NamespaceClassName##::Type::RTTI_INTERNAL_MEMBERS_REGISTRATION() \
 { \
 	using CurrentlyImplementedType = NamespaceClassName##; \
 	__VA_ARGS__ \
@@ -1469,8 +2267,7 @@ namespace rtti
 
 			static const DerivedClass& GetInstance()
 			{
-				static const DerivedClass& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< DerivedClass >();
-				return s_typeInstance;
+				return ::rtti::internal::GetOrRegisterTypeInstance< DerivedClass >();
 			}
 
 			virtual ::rtti::Type::Kind GetKind() const override
@@ -1480,11 +2277,11 @@ namespace rtti
 
 		protected:
 			PointerTypeImplementation()
-				: ParentClass( CalcId(), GetInternalTypeDescStatic().ConstructName() + c_namePostfix)
+				: ParentClass( CalcId(), internal::NamePool::Get().Intern( std::string( GetInternalTypeDescStatic().ConstructName() ) + c_namePostfix ).m_name )
 			{}
 
-			PointerTypeImplementation( ID typeId, std::string&& name )
-				: ParentClass( typeId, std::move( name ) )
+			PointerTypeImplementation( ID typeId, std::string_view name )
+				: ParentClass( typeId, name )
 			{}
 		};
 	}
@@ -1530,14 +2327,21 @@ namespace rtti
 		virtual size_t GetSize() const override { return sizeof( void* ); }
 		virtual size_t GetAlignment() const override { return alignof( void* ); }
 
-		virtual const char* GetName() const override { return m_strName.c_str(); }
+		virtual const char* GetName() const override { return m_name.data(); }
+
+		virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+		{
+			stats.m_namesBytes += m_name.size() + 1u;
+		}
 
 	protected:
-		PointerType( ID typeId, std::string&& name )
+		PointerType( ID typeId, std::string_view name )
 			: Type( typeId )
-			, m_strName( std::move( name ) )
+			, m_name( name )
 		{}
-		std::string m_strName;
+
+		// Interned.
+		std::string_view m_name;
 	};
 
 	template< class T >
@@ -1567,12 +2371,12 @@ namespace rtti
 				ID id = internal::CalcHash( DerivedType::GetBaseName() );
 				id = internal::CalcHash( "< ", id );
 				const auto internalTypes = DerivedType::GetInternalTypeDescsStatic();
-				id = internal::CalcHash( internalTypes[ 0u ].ConstructName().c_str(), id);
+				id = internal::CalcHash( internalTypes[ 0u ].ConstructName(), id );
 
 				for ( size_t i = 1u; i < internalTypes.size(); ++i )
 				{
 					id = internal::CalcHash( ", ", id);
-					id = internal::CalcHash( internalTypes[ i ].ConstructName().c_str(), id);
+					id = internal::CalcHash( internalTypes[ i ].ConstructName(), id );
 				}
 
 				return internal::CalcHash( " >", id );
@@ -1580,13 +2384,17 @@ namespace rtti
 
 			static const DerivedType& GetInstance()
 			{
-				static const DerivedType& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< DerivedType >();
-				return s_typeInstance;
+				return ::rtti::internal::GetOrRegisterTypeInstance< DerivedType >();
 			}
 
 			virtual const char* GetName() const override
 			{
-				return m_name.c_str();
+				return m_name.data();
+			}
+
+			virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+			{
+				stats.m_namesBytes += m_name.size() + 1u;
 			}
 
 			virtual void ConstructInPlace( void* dest ) const override
@@ -1627,21 +2435,23 @@ namespace rtti
 			{
 				const auto internalTypes = DerivedType::GetInternalTypeDescsStatic();
 
-				m_name += DerivedType::GetBaseName();
-				m_name += "< ";
-				internalTypes[ 0u ].AppendName( m_name );
+				std::string name = DerivedType::GetBaseName();
+				name += "< ";
+				name += internalTypes[ 0u ].ConstructName();
 
 				for ( size_t i = 1u; i < internalTypes.size(); ++i )
 				{
-					m_name += ", ";
-					internalTypes[ i ].AppendName( m_name );
+					name += ", ";
+					name += internalTypes[ i ].ConstructName();
 				}
 
-				m_name += " >";
+				name += " >";
+				m_name = internal::NamePool::Get().Intern( name ).m_name;
 			}
 
 		private:
-			std::string m_name;
+			// Interned.
+			std::string_view m_name;
 		};
 	}
 }
@@ -1704,6 +2514,12 @@ namespace rtti
 				return ::rtti::Type::Kind::Class;
 			}
 
+			virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+			{
+				internal::TemplateType< PairType< T1, T2 >, std::pair< T1, T2 >, Type >::CollectMemoryStats( stats );
+				Type::CollectPropertiesMemoryStats( m_properties, stats );
+			}
+
 		private:
 			PairType()
 			{
@@ -1739,6 +2555,11 @@ namespace rtti
 		virtual size_t GetElementsAmount( const void* address ) const = 0;
 
 		virtual void VisitElementsAsProperties( const void* containerAddress, const std::function< VisitOutcome( const rtti::Property& ) >& visitFunc ) const = 0;
+		virtual void VisitElements( const void* containerAddress, const std::function< VisitOutcome( const void* ) >& visitFunc ) const = 0;
+
+		// Returns address of the first element if elements are stored contiguously, nullptr otherwise.
+		virtual void* GetData( void* address ) const { return nullptr; }
+		virtual const void* GetData( const void* address ) const { return nullptr; }
 
 	protected:
 		using Type::Type;
@@ -1749,6 +2570,8 @@ namespace rtti
 	public:
 		virtual void EmplaceElement( void* containerAddress, void* elementAddress ) const = 0;
 		virtual void AddDefaultElement( void* containerAddress ) const = 0;
+		virtual void AddDefaultElements( void* containerAddress, size_t amount ) const = 0;
+		virtual void Reserve( void* containerAddress, size_t amount ) const = 0;
 		virtual void Clear( void* containerAddress ) const = 0;
 		virtual void RemoveElementAtIndex( void* containerAddress, size_t index ) const = 0;
 
@@ -1792,6 +2615,22 @@ namespace rtti
 				}
 			}
 
+			virtual void VisitElements( const void* containerAddress, const std::function< VisitOutcome( const void* ) >& visitFunc ) const override
+			{
+				for ( const auto& element : *static_cast< const TrueType* >( containerAddress ) )
+				{
+					if ( visitFunc( &element ) == VisitOutcome::Break )
+					{
+						break;
+					}
+				}
+			}
+
+			virtual void Reserve( void* containerAddress, size_t amount ) const override
+			{
+				static_cast< TrueType* >( containerAddress )->reserve( amount );
+			}
+
 		private:
 			static std::array< InternalTypeDesc, 1 > GetInternalTypeDescsStatic()
 			{
@@ -1802,6 +2641,63 @@ namespace rtti
 }
 #pragma endregion
 
+#pragma region TypeLayoutHashImpl
+namespace rtti
+{
+	inline uint64 Type::GetLayoutHash() const
+	{
+		uint64 hash = m_layoutHash;
+		if ( hash == 0u )
+		{
+			std::vector< const Type* > stack;
+			hash = CalcLayoutHash( stack );
+			if ( GetKind() != Kind::RuntimeType )
+			{
+				m_layoutHash = hash;
+			}
+		}
+
+		return hash;
+	}
+
+	// Nested types are always recalculated, their cached hashes might have been calculated with a different cycle cut.
+	inline uint64 Type::CalcLayoutHash( std::vector< const Type* >& stack ) const
+	{
+		uint64 hash = GetID();
+		if ( std::find( stack.begin(), stack.end(), this ) != stack.end() )
+		{
+			return hash;
+		}
+
+		stack.emplace_back( this );
+		hash = hash * 31u + static_cast< uint64 >( GetKind() );
+		hash = hash * 31u + GetSize();
+		hash = hash * 31u + GetAlignment();
+		switch ( GetKind() )
+		{
+		case Kind::Array:
+		case Kind::Vector:
+		case Kind::Set:
+		case Kind::Map:
+			hash = hash * 31u + static_cast< const ContainerType* >( this )->GetInternalTypeDesc().GetType().CalcLayoutHash( stack );
+			break;
+		default:
+			for ( size_t i = 0u; i < GetPropertiesAmount(); ++i )
+			{
+				const Property* property = GetProperty( i );
+				hash = hash * 31u + property->GetID();
+				hash = hash * 31u + property->GetOffset();
+				hash = hash * 31u + property->GetType().CalcLayoutHash( stack );
+			}
+			break;
+		}
+		stack.pop_back();
+
+		return hash == 0u ? 1u : hash;
+	}
+}
+#pragma endregion
+
 #pragma region ArrayType
 namespace rtti
 {
@@ -1821,7 +2717,7 @@ namespace rtti
 
 		static const ArrayType& GetInstance()
 		{
-			return ::rtti::RTTI::GetMutable().GetOrRegisterType< ArrayType >();
+			return ::rtti::internal::GetOrRegisterTypeInstance< ArrayType >();
 		}
 
 		static InternalTypeDesc GetInternalTypeDescStatic()
@@ -1836,7 +2732,12 @@ namespace rtti
 
 		const char* GetName() const override
 		{
-			return m_name.c_str();
+			return m_name.data();
+		}
+
+		virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+		{
+			stats.m_namesBytes += m_name.size() + 1u;
 		}
 
 		virtual Kind GetKind() const override 
@@ -1922,17 +2823,41 @@ namespace rtti
 			}
 		}
 
+		virtual void VisitElements( const void* containerAddress, const std::function< VisitOutcome( const void* ) >& visitFunc ) const override
+		{
+			const T* arr = static_cast< const T* >( containerAddress );
+			for ( size_t i = 0u; i < Count; ++i )
+			{
+				if ( visitFunc( &arr[ i ] ) == VisitOutcome::Break )
+				{
+					break;
+				}
+			}
+		}
+
+		virtual void* GetData( void* address ) const override
+		{
+			return address;
+		}
+
+		virtual const void* GetData( const void* address ) const override
+		{
+			return address;
+		}
+
 	private:
 		ArrayType()
 			: ContainerType( CalcId() )
 		{
-			GetInternalTypeDesc().AppendName( m_name );
-			m_name += "[";
-			m_name += std::to_string( Count );
-			m_name += "]";
+			std::string name( GetInternalTypeDesc().ConstructName() );
+			name += "[";
+			name += std::to_string( Count );
+			name += "]";
+			m_name = internal::NamePool::Get().Intern( name ).m_name;
 		}
 
-		std::string m_name;
+		// Interned.
+		std::string_view m_name;
 	};
 }
 
@@ -1965,21 +2890,56 @@ namespace rtti
 
 		virtual void EmplaceElement( void* containerAddress, void* elementAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::vector< T >* >( containerAddress )->emplace_back( std::move( *static_cast< T* >( elementAddress ) ) );
 		}
 
 		virtual void AddDefaultElement( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::vector< T >* >( containerAddress )->emplace_back();
 		}
 
+		virtual void AddDefaultElements( void* containerAddress, size_t amount ) const override
+		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
+			std::vector< T >* vector = static_cast< std::vector< T >* >( containerAddress );
+			vector->resize( vector->size() + amount );
+		}
+
+		virtual void* GetData( void* address ) const override
+		{
+			if constexpr ( std::is_same_v< std::remove_const_t< T >, bool > )
+			{
+				return nullptr;
+			}
+			else
+			{
+				return static_cast< std::vector< T >* >( address )->data();
+			}
+		}
+
+		virtual const void* GetData( const void* address ) const override
+		{
+			if constexpr ( std::is_same_v< std::remove_const_t< T >, bool > )
+			{
+				return nullptr;
+			}
+			else
+			{
+				return static_cast< const std::vector< T >* >( address )->data();
+			}
+		}
+
 		virtual void Clear( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::vector< T >* >( containerAddress )->clear();
 		}
 
 		virtual void RemoveElementAtIndex( void* containerAddress, size_t index ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			std::vector< T >* vector = static_cast< std::vector< T >* >( containerAddress );
 			vector->erase( vector->begin() + index );
 		}
@@ -2015,21 +2975,33 @@ namespace rtti
 
 		virtual void EmplaceElement( void* containerAddress, void* elementAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::unordered_set< T >* >( containerAddress )->emplace( std::move( *static_cast< T* >( elementAddress ) ) );
 		}
 
 		virtual void AddDefaultElement( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::unordered_set< T >* >( containerAddress )->emplace();
 		}
 
+		virtual void AddDefaultElements( void* containerAddress, size_t amount ) const override
+		{
+			for ( size_t i = 0u; i < amount; ++i )
+			{
+				AddDefaultElement( containerAddress );
+			}
+		}
+
 		virtual void Clear( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::unordered_set< T >* >( containerAddress )->clear();
 		}
 
 		virtual void RemoveElementAtIndex( void* containerAddress, size_t index ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			std::unordered_set< T >* set = static_cast< std::unordered_set< T >* >( containerAddress );
 			size_t i = 0u;
 			for ( auto it = set->begin(); it != set->end(); ++it )
@@ -2037,6 +3009,7 @@ namespace rtti
 				if ( i++ == index )
 				{
 					set->erase( it );
+					break;
 				}
 			}
 		}
@@ -2073,22 +3046,34 @@ namespace rtti
 
 		virtual void EmplaceElement( void* containerAddress, void* elementAddress ) const override
 		{
-			const std::pair< TKey, TValue >&& pair = std::move( *static_cast< std::pair< TKey, TValue >* >( elementAddress ) );
-			static_cast< std::unordered_map< TKey, TValue >* >( containerAddress )->emplace( pair.first, pair.second );
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
+			std::pair< TKey, TValue >& pair = *static_cast< std::pair< TKey, TValue >* >( elementAddress );
+			static_cast< std::unordered_map< TKey, TValue >* >( containerAddress )->emplace( std::move( pair.first ), std::move( pair.second ) );
 		}
 
 		virtual void AddDefaultElement( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::unordered_map< TKey, TValue >* >( containerAddress )->emplace( TKey(), TValue() );
 		}
 
+		virtual void AddDefaultElements( void* containerAddress, size_t amount ) const override
+		{
+			for ( size_t i = 0u; i < amount; ++i )
+			{
+				AddDefaultElement( containerAddress );
+			}
+		}
+
 		virtual void Clear( void* containerAddress ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			static_cast< std::unordered_map< TKey, TValue >* >( containerAddress )->clear();
 		}
 
 		virtual void RemoveElementAtIndex( void* containerAddress, size_t index ) const override
 		{
+			RTTI_INTERNAL_ON_CONTAINER_CHANGED( containerAddress )
 			std::unordered_map< TKey, TValue >* map = static_cast< std::unordered_map< TKey, TValue >* >( containerAddress );
 			size_t i = 0u;
 			for ( auto it = map->begin(); it != map->end(); ++it )
@@ -2096,6 +3081,7 @@ namespace rtti
 				if ( i++ == index )
 				{
 					map->erase( it );
+					break;
 				}
 			}
 		}
@@ -2151,8 +3137,7 @@ namespace rtti
 
 		static const rtti::PrimitiveType< T >& GetInstance()
 		{
-			static const rtti::PrimitiveType< T >& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< rtti::PrimitiveType< T > >();
-			return s_typeInstance;
+			return ::rtti::internal::GetOrRegisterTypeInstance< rtti::PrimitiveType< T > >();
 		}
 
 	protected:
@@ -2192,6 +3177,7 @@ namespace rtti
 		{
 			ValueType m_value = 0;
 			const char* m_name = nullptr;
+			ID m_nameHash = 0u;
 		};
 
 		template< class TFunc >
@@ -2213,34 +3199,223 @@ namespace rtti
 
 		virtual void SetCurrentMember( void* address, const MemberDesc& member ) const = 0;
 
-	protected:
 		virtual ValueType GetCurrentValue( const void* address ) const = 0;
 
-		template< class T >
-		const MemberDesc* GetMemberForValue( T value ) const
+		virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+		{
+			stats.m_propertiesBytes += internal::GetHeapMemoryUsage( m_members ) + internal::GetHeapMemoryUsage( m_valueTable )
+				+ internal::GetHeapMemoryUsage( m_sortedValues ) + internal::GetHeapMemoryUsage( m_nameTable ) + internal::GetHeapMemoryUsage( m_bitMembers );
+		}
+
+		const MemberDesc* FindMember( std::string_view name ) const
 		{
-			auto it = std::find_if( m_members.begin(), m_members.end(), [ & ]( MemberDesc member ) { return member.m_value == static_cast< ValueType >( value ); } );
-			if ( it != m_members.end() )
+			if ( m_nameTable.empty() )
+			{
+				return nullptr;
+			}
+
+			const ID nameHash = internal::CalcHash( name );
+			const size_t mask = m_nameTable.size() - 1u;
+			for ( size_t i = static_cast< size_t >( nameHash ) & mask; m_nameTable[ i ] != c_noMember; i = ( i + 1u ) & mask )
 			{
-				return &*it;
+				const MemberDesc& member = m_members[ m_nameTable[ i ] ];
+				if ( member.m_nameHash == nameHash && name == member.m_name )
+				{
+					return &member;
+				}
 			}
 
 			return nullptr;
 		}
 
-		const ValueType* GetValueFromName( const char* name ) const
+		// Registered with RTTI_DECLARE_AND_IMPLEMENT_FLAGS_ENUM.
+		bool IsFlags() const
 		{
-			auto it = std::find_if( m_members.begin(), m_members.end(), [ & ]( MemberDesc member ) { return strcmp( member.m_name, name ) == 0; } );
-			if ( it != m_members.end() )
+			return !m_bitMembers.empty();
+		}
+
+		// Appends the name of the member with exactly this value or names of members of set bits joined with '|'.
+		// Fails if any set bit doesn't have its own member.
+		bool AppendFlagNames( ValueType value, std::string& destination ) const
+		{
+			if ( const MemberDesc* member = GetMemberForValue( value ) )
 			{
-				return &it->m_value;
+				destination += member->m_name;
+				return true;
+			}
+
+			if ( !IsFlags() )
+			{
+				return false;
+			}
+
+			const size_t initialSize = destination.size();
+			for ( ValueType bits = value & GetBitsMask(); bits != 0u; bits &= bits - 1u )
+			{
+				const uint32_t memberIndex = m_bitMembers[ std::countr_zero( bits ) ];
+				if ( memberIndex == c_noMember )
+				{
+					destination.resize( initialSize );
+					return false;
+				}
+
+				if ( destination.size() != initialSize )
+				{
+					destination += '|';
+				}
+				destination += m_members[ memberIndex ].m_name;
+			}
+
+			return true;
+		}
+
+		// Parses names joined with '|', e.g. "Read|Write", an empty string gives 0.
+		bool ParseFlagNames( std::string_view names, ValueType& outValue ) const
+		{
+			ValueType value = 0u;
+			while ( !names.empty() )
+			{
+				const size_t separator = names.find( '|' );
+				std::string_view name = names.substr( 0u, separator );
+				names = separator == std::string_view::npos ? std::string_view() : names.substr( separator + 1u );
+
+				const size_t first = name.find_first_not_of( ' ' );
+				name = first == std::string_view::npos ? std::string_view() : name.substr( first, name.find_last_not_of( ' ' ) - first + 1u );
+
+				const MemberDesc* member = FindMember( name );
+				if ( !member || ( separator != std::string_view::npos && names.empty() ) )
+				{
+					return false;
+				}
+
+				value |= member->m_value;
+			}
+
+			outValue = value;
+			return true;
+		}
+
+	protected:
+
+		template< class T >
+		const MemberDesc* GetMemberForValue( T value ) const
+		{
+			const ValueType wantedValue = static_cast< ValueType >( value );
+			if ( !m_valueTable.empty() )
+			{
+				const ValueType index = wantedValue - m_minValue;
+				return index < m_valueTable.size() && m_valueTable[ index ] != c_noMember ? &m_members[ m_valueTable[ index ] ] : nullptr;
+			}
+
+			auto it = std::lower_bound( m_sortedValues.begin(), m_sortedValues.end(), wantedValue, []( const auto& entry, ValueType value ) { return entry.first < value; } );
+			if ( it != m_sortedValues.end() && it->first == wantedValue )
+			{
+				return &m_members[ it->second ];
+			}
+
+			return nullptr;
+		}
+
+		const ValueType* GetValueFromName( const char* name ) const
+		{
+			if ( const MemberDesc* member = FindMember( name ) )
+			{
+				return &member->m_value;
 			}
 
 			return nullptr;
 		}
 
+		// Called once all members are registered. Values close to each other get a directly indexed table, others a sorted one.
+		// With duplicated values or names the first registered member wins.
+		void BuildLookupTables()
+		{
+			m_valueTable.clear();
+			m_sortedValues.clear();
+			m_nameTable.clear();
+			if ( m_members.empty() )
+			{
+				return;
+			}
+
+			// Compared as signed, so negative values of signed enums are next to zero.
+			const auto [ minMember, maxMember ] = std::minmax_element( m_members.begin(), m_members.end(), []( const MemberDesc& lhs, const MemberDesc& rhs )
+				{
+					return static_cast< int64 >( lhs.m_value ) < static_cast< int64 >( rhs.m_value );
+				} );
+
+			const ValueType span = maxMember->m_value - minMember->m_value;
+			if ( span < std::max< ValueType >( c_minDenseTableSize, 2u * m_members.size() ) )
+			{
+				m_minValue = minMember->m_value;
+				m_valueTable.assign( static_cast< size_t >( span ) + 1u, c_noMember );
+				for ( uint32_t i = 0u; i < m_members.size(); ++i )
+				{
+					uint32_t& entry = m_valueTable[ static_cast< size_t >( m_members[ i ].m_value - m_minValue ) ];
+					entry = entry == c_noMember ? i : entry;
+				}
+			}
+			else
+			{
+				m_sortedValues.reserve( m_members.size() );
+				for ( uint32_t i = 0u; i < m_members.size(); ++i )
+				{
+					m_sortedValues.emplace_back( m_members[ i ].m_value, i );
+				}
+
+				std::stable_sort( m_sortedValues.begin(), m_sortedValues.end(), []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+				m_sortedValues.erase( std::unique( m_sortedValues.begin(), m_sortedValues.end(), []( const auto& lhs, const auto& rhs ) { return lhs.first == rhs.first; } ), m_sortedValues.end() );
+			}
+
+			// Open addressing with linear probing, at most half full.
+			m_nameTable.assign( std::bit_ceil( 2u * m_members.size() ), c_noMember );
+			const size_t mask = m_nameTable.size() - 1u;
+			for ( uint32_t i = 0u; i < m_members.size(); ++i )
+			{
+				size_t index = static_cast< size_t >( m_members[ i ].m_nameHash ) & mask;
+				while ( m_nameTable[ index ] != c_noMember )
+				{
+					index = ( index + 1u ) & mask;
+				}
+				m_nameTable[ index ] = i;
+			}
+		}
+
+		// Maps every bit to the first registered member with only this bit set.
+		void BuildFlagsTables()
+		{
+			m_bitMembers.assign( sizeof( ValueType ) * 8u, c_noMember );
+			for ( uint32_t i = 0u; i < m_members.size(); ++i )
+			{
+				const ValueType value = m_members[ i ].m_value & GetBitsMask();
+				if ( std::has_single_bit( value ) && m_bitMembers[ std::countr_zero( value ) ] == c_noMember )
+				{
+					m_bitMembers[ std::countr_zero( value ) ] = i;
+				}
+			}
+		}
+
 		using Type::Type;
 		std::vector< MemberDesc > m_members;
+
+	private:
+		// Values of signed enums are sign extended.
+		ValueType GetBitsMask() const
+		{
+			return GetSize() < sizeof( ValueType ) ? ( ValueType( 1u ) << ( GetSize() * 8u ) ) - 1u : ~ValueType( 0u );
+		}
+
+		static constexpr uint32_t c_noMember = std::numeric_limits< uint32_t >::max();
+		static constexpr ValueType c_minDenseTableSize = 64u;
+
+		// Indices of members, dense enums use m_valueTable indexed by value - m_minValue, sparse ones m_sortedValues.
+		ValueType m_minValue = 0u;
+		std::vector< uint32_t > m_valueTable;
+		std::vector< std::pair< ValueType, uint32_t > > m_sortedValues;
+		std::vector< uint32_t > m_nameTable;
+
+		// Only for flags enums, indexed by bit.
+		std::vector< uint32_t > m_bitMembers;
 	};
 
 	template< class T >
@@ -2301,8 +3476,7 @@ namespace rtti
 		
 		static const rtti::EnumType< T >& GetInstance()
 		{
-			static const rtti::EnumType< T >& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< rtti::EnumType< T > >();
-			return s_typeInstance;
+			return ::rtti::internal::GetOrRegisterTypeInstance< rtti::EnumType< T > >();
 		}
 
 		const char* GetValueName( T value ) const
@@ -2349,10 +3523,14 @@ void ::rtti::EnumType< type >::OnRegistered() \
 	using CurrentType = type##; \
 	using CurrentlyImplementedType = ::rtti::EnumType<##type##>; \
 	__VA_ARGS__ \
+	BuildLookupTables(); \
 } \
 RTTI_INTERNAL_REGISTER_TYPE( ::rtti::EnumType<##type##> )
 
-#define RTTI_REGISTER_ENUM_MEMBER( Member ) m_members.push_back( { static_cast< EnumTypeBase::ValueType >( CurrentType::##Member ) , #Member } );
+// Enum of bit flags, values are written and parsed as names of their bits joined with '|'.
+#define RTTI_DECLARE_AND_IMPLEMENT_FLAGS_ENUM( type, ... ) RTTI_DECLARE_AND_IMPLEMENT_ENUM( type, __VA_ARGS__ BuildFlagsTables(); )
+
+#define RTTI_REGISTER_ENUM_MEMBER( Member ) m_members.push_back( { static_cast< EnumTypeBase::ValueType >( CurrentType::##Member ) , #Member, ::rtti::internal::CalcHash( #Member ) } );
 #pragma endregion
 
 #pragma region RuntimeType
@@ -2360,6 +3538,13 @@ namespace rtti
 {
 	namespace internal
 	{
+		// Bumped whenever properties of any runtime type change. Caches built from runtime types compare it to find out that they are stale.
+		inline std::atomic< uint64 >& GetRuntimeLayoutsVersion()
+		{
+			static std::atomic< uint64 > s_version = 0u;
+			return s_version;
+		}
+
 		template< class TType >
 		TType& CreateType( std::string name )
 		{
@@ -2429,6 +3614,27 @@ namespace rtti
 		};
 	}
 
+	// Order of properties added to a RuntimeType between BeginLayout() and FinalizeLayout().
+	enum class LayoutGroup : uint8_t
+	{
+		Hot,
+		Default,
+		Cold
+	};
+
+	struct LayoutReport
+	{
+		// Bytes taken by the laid out properties with padding, rounded up to their biggest alignment.
+		size_t m_declaredOrderSize = 0u;
+		size_t m_finalizedSize = 0u;
+
+		// Negative when layout groups made the finalized layout bigger than the declared order.
+		int64 GetSavedBytes() const
+		{
+			return static_cast< int64 >( m_declaredOrderSize ) - static_cast< int64 >( m_finalizedSize );
+		}
+	};
+
 	template< class ParentClassType = rtti::Type >
 	class RuntimeType : public ParentClassType, public internal::RuntimeTypeHelper< ParentClassType >
 	{
@@ -2436,34 +3642,136 @@ namespace rtti
 		using internal::RuntimeTypeHelper< ParentClassType >::GetParentTypeInstance;
 	public:
 		using internal::RuntimeTypeHelper< ParentClassType >::Create;
-		const ::rtti::Property& AddProperty( const char* name, const Type& type, InstanceFlags flags )
+		const ::rtti::Property& AddProperty( const char* name, const Type& type, InstanceFlags flags, LayoutGroup group = LayoutGroup::Default )
 		{
-			const auto* parentTypeInstance = GetParentTypeInstance();
-			size_t parentSize = parentTypeInstance ? parentTypeInstance->GetSize() : 0;
-			size_t currentOffset = parentSize;
-			
-			if ( GetPropertiesAmount() > 0u )
+			const size_t currentOffset = m_layoutStarted ? 0u : AlignOffset( GetPropertiesEnd( m_properties.size() ), type.GetAlignment() );
+			m_properties.emplace_back( ::rtti::Type::CreateProperty( internal::NamePool::Get().Intern( name ).m_name.data(), static_cast< size_t >( -1 ), currentOffset, type, flags ) );
+			++internal::GetRuntimeLayoutsVersion();
+			if ( m_layoutStarted )
 			{
-				const auto& lastProperty = GetProperty( GetPropertiesAmount() - 1u );
-				currentOffset = lastProperty->GetOffset() + lastProperty->GetType().GetSize();
-				currentOffset = ( ( currentOffset + ( type.GetAlignment() - 1u ) ) & ~( type.GetAlignment() - 1u ) );
+				m_layoutGroups.push_back( group );
+				return m_properties.back();
 			}
 
-			m_properties.emplace_back( ::rtti::Type::CreateProperty( name, static_cast< size_t >( -1 ), currentOffset, type, flags ) );
-			m_size = currentOffset - parentSize + type.GetSize();
+			const auto* parentTypeInstance = GetParentTypeInstance();
+			m_size = currentOffset - ( parentTypeInstance ? parentTypeInstance->GetSize() : 0u ) + type.GetSize();
 			m_alignment = std::max( m_alignment, type.GetAlignment() );
+			AppendLifetimeOp( m_properties.back() );
 			return m_properties.back();
 		}
 
 		template< class T >
-		const ::rtti::Property& AddProperty( const char* name )
+		const ::rtti::Property& AddProperty( const char* name, LayoutGroup group = LayoutGroup::Default )
+		{
+			return AddProperty( name, GetTypeInstanceOf< T >(), GetInstanceFlags< T >(), group );
+		}
+
+		// Properties added from now on don't get offsets until FinalizeLayout() is called. Until then the type has no valid size,
+		// so its instances can't be created, moved or destroyed and it can't be serialized.
+		void BeginLayout()
+		{
+			if ( !m_layoutStarted )
+			{
+				m_layoutStarted = true;
+				m_firstLaidOutProperty = m_properties.size();
+			}
+		}
+
+		// Places properties added since BeginLayout() ordered by their layout groups, then by alignment and size, both descending.
+		// Recreates these properties, so references to them are invalidated.
+		LayoutReport FinalizeLayout()
 		{
-			return AddProperty( name, GetTypeInstanceOf< T >(), GetInstanceFlags< T >() );
+			LayoutReport report;
+			if ( !m_layoutStarted )
+			{
+				return report;
+			}
+
+			m_layoutStarted = false;
+			const size_t laidOutAmount = m_properties.size() - m_firstLaidOutProperty;
+			std::vector< size_t > order( laidOutAmount );
+			for ( size_t i = 0u; i < laidOutAmount; ++i )
+			{
+				order[ i ] = i;
+			}
+
+			const auto getPropertyType = [ this ]( size_t index ) -> const Type& { return m_properties[ m_firstLaidOutProperty + index ].GetType(); };
+			std::stable_sort( order.begin(), order.end(), [ & ]( size_t lhs, size_t rhs )
+				{
+					const Type& lhsType = getPropertyType( lhs );
+					const Type& rhsType = getPropertyType( rhs );
+					if ( m_layoutGroups[ lhs ] != m_layoutGroups[ rhs ] )
+					{
+						return m_layoutGroups[ lhs ] < m_layoutGroups[ rhs ];
+					}
+
+					if ( lhsType.GetAlignment() != rhsType.GetAlignment() )
+					{
+						return lhsType.GetAlignment() > rhsType.GetAlignment();
+					}
+
+					return lhsType.GetSize() > rhsType.GetSize();
+				} );
+
+			const size_t start = GetPropertiesEnd( m_firstLaidOutProperty );
+			size_t alignment = 1u;
+			size_t declaredOrderEnd = start;
+			size_t finalizedEnd = start;
+			std::vector< size_t > offsets( laidOutAmount );
+			for ( size_t i = 0u; i < laidOutAmount; ++i )
+			{
+				const Type& declaredType = getPropertyType( i );
+				declaredOrderEnd = AlignOffset( declaredOrderEnd, declaredType.GetAlignment() ) + declaredType.GetSize();
+
+				const Type& finalizedType = getPropertyType( order[ i ] );
+				offsets[ order[ i ] ] = AlignOffset( finalizedEnd, finalizedType.GetAlignment() );
+				finalizedEnd = offsets[ order[ i ] ] + finalizedType.GetSize();
+				alignment = std::max( alignment, declaredType.GetAlignment() );
+			}
+
+			// Properties keep the order in which they were added.
+			std::vector< ::rtti::Property > properties;
+			properties.reserve( m_properties.size() );
+			for ( size_t i = 0u; i < m_properties.size(); ++i )
+			{
+				const ::rtti::Property& property = m_properties[ i ];
+				if ( i < m_firstLaidOutProperty )
+				{
+					properties.emplace_back( std::move( m_properties[ i ] ) );
+				}
+				else
+				{
+					properties.emplace_back( ::rtti::Type::CreateProperty( property.GetName(), static_cast< size_t >( -1 ), offsets[ i - m_firstLaidOutProperty ], property.GetType(), property.GetFlags() ) );
+				}
+			}
+			m_properties.swap( properties );
+			++internal::GetRuntimeLayoutsVersion();
+			RebuildLifetimeOps();
+
+			m_layoutGroups.clear();
+			report.m_declaredOrderSize = AlignOffset( declaredOrderEnd - start, alignment );
+			report.m_finalizedSize = AlignOffset( finalizedEnd - start, alignment );
+
+			if ( laidOutAmount > 0u )
+			{
+				const auto* parentTypeInstance = GetParentTypeInstance();
+				m_size = GetPropertiesEnd( m_properties.size() ) - ( parentTypeInstance ? parentTypeInstance->GetSize() : 0u );
+				m_alignment = std::max( m_alignment, alignment );
+			}
+
+			return report;
 		}
 
 		virtual const char* GetName() const override
 		{
-			return m_name.c_str();
+			return m_name.data();
+		}
+
+		virtual void CollectMemoryStats( TypeMemoryStats& stats ) const override
+		{
+			stats.m_namesBytes += m_name.size() + 1u;
+			Type::CollectPropertiesMemoryStats( m_properties, stats );
+			stats.m_propertiesBytes += internal::GetHeapMemoryUsage( m_lifetimeOps ) + internal::GetHeapMemoryUsage( m_destroyedOps );
 		}
 
 		virtual ::rtti::Type::Kind GetKind() const override
@@ -2473,15 +3781,23 @@ namespace rtti
 
 		virtual void ConstructInPlace( void* dest ) const override
 		{
+			assert( !m_layoutStarted && "Layout of the runtime type has to be finalized first." );
 			if ( const auto* parentTypeInstance = GetParentTypeInstance() )
 			{
 				parentTypeInstance->ConstructInPlace( dest );
 			}
 
-			for ( const auto& property : m_properties )
+			for ( const auto& op : m_lifetimeOps )
 			{
-				const auto& type = property.GetType();
-				type.ConstructInPlace( static_cast< uint8_t* >( dest ) + property.GetOffset() );
+				uint8_t* address = static_cast< uint8_t* >( dest ) + op.m_offset;
+				if ( op.m_type )
+				{
+					op.m_type->ConstructInPlace( address );
+				}
+				else
+				{
+					std::memset( address, 0, op.m_size );
+				}
 			}
 		}
 
@@ -2495,35 +3811,47 @@ namespace rtti
 #if RTTI_REQUIRE_MOVE_CTOR
 		virtual void MoveInPlace( void* dest, void* src ) const override
 		{
+			assert( !m_layoutStarted && "Layout of the runtime type has to be finalized first." );
 			if ( const auto* parentTypeInstance = GetParentTypeInstance() )
 			{
 				parentTypeInstance->MoveInPlace( dest, src );
 			}
 
-			for ( const auto& property : m_properties )
+			for ( const auto& op : m_lifetimeOps )
 			{
-				const auto& type = property.GetType();
-				type.MoveInPlace( static_cast< uint8_t* >( dest ) + property.GetOffset(), static_cast< uint8_t* >( src ) + property.GetOffset() );
+				uint8_t* destAddress = static_cast< uint8_t* >( dest ) + op.m_offset;
+				uint8_t* srcAddress = static_cast< uint8_t* >( src ) + op.m_offset;
+				if ( op.m_type )
+				{
+					op.m_type->MoveInPlace( destAddress, srcAddress );
+				}
+				else
+				{
+					std::memcpy( destAddress, srcAddress, op.m_size );
+				}
 			}
 		}
 #endif
 
 		virtual void Destroy( void* address ) const override
 		{
+			assert( !m_layoutStarted && "Layout of the runtime type has to be finalized first." );
+			RTTI_INTERNAL_ON_OBJECT_DESTROYED( address )
 			if ( const auto* parentTypeInstance = GetParentTypeInstance() )
 			{
 				parentTypeInstance->Destroy( address );
 			}
 
-			for ( const auto& property : m_properties )
+			for ( size_t index : m_destroyedOps )
 			{
-				const auto& type = property.GetType();
-				type.Destroy( static_cast< uint8_t* >( address ) + property.GetOffset() );
+				const auto& op = m_lifetimeOps[ index ];
+				op.m_type->Destroy( static_cast< uint8_t* >( address ) + op.m_offset );
 			}
 		}
 
 		virtual size_t GetSize() const override
 		{
+			assert( !m_layoutStarted && "Layout of the runtime type has to be finalized first." );
 			return m_size;
 		}
 
@@ -2532,6 +3860,11 @@ namespace rtti
 			return m_alignment;
 		}
 
+		virtual bool IsLayoutFinalized() const override
+		{
+			return !m_layoutStarted;
+		}
+
 		virtual size_t GetPropertiesAmount() const override 
 		{ 
 			const auto* parentTypeInstance = GetParentTypeInstance();
@@ -2557,20 +3890,126 @@ namespace rtti
 	protected:
 		RuntimeType( std::string name )
 			: ParentClassType( name.c_str() )
-			, m_name( std::move( name ) )
+			, m_name( internal::NamePool::Get().Intern( name ).m_name )
 		{
 			if ( const auto* parentTypeInstance = GetParentTypeInstance() )
 			{
 				m_size = parentTypeInstance->GetSize();
 				m_alignment = parentTypeInstance->GetAlignment();
 			}	
+
+			// A new type might reuse the address of a destroyed one.
+			++internal::GetRuntimeLayoutsVersion();
 		}
 
 	private:
-		std::string m_name;
+		static size_t AlignOffset( size_t offset, size_t alignment )
+		{
+			return ( offset + ( alignment - 1u ) ) & ~( alignment - 1u );
+		}
+
+		// End of the first propertiesAmount own properties, or of the parent's properties.
+		// Laid out properties aren't placed in the order of their indices, so the end is the furthest one of all of them.
+		size_t GetPropertiesEnd( size_t propertiesAmount ) const
+		{
+			size_t end = 0u;
+			for ( size_t i = 0u; i < propertiesAmount; ++i )
+			{
+				end = std::max( end, m_properties[ i ].GetOffset() + m_properties[ i ].GetType().GetSize() );
+			}
+
+			if ( propertiesAmount > 0u )
+			{
+				return end;
+			}
+
+			const auto* parentTypeInstance = GetParentTypeInstance();
+			if ( !parentTypeInstance )
+			{
+				return 0u;
+			}
+
+			end = parentTypeInstance->GetSize();
+			for ( size_t i = 0u; i < parentTypeInstance->GetPropertiesAmount(); ++i )
+			{
+				const auto* property = parentTypeInstance->GetProperty( i );
+				end = std::max( end, property->GetOffset() + property->GetType().GetSize() );
+			}
+
+			return end;
+		}
+
+		// Types whose instances are zero when default constructed and which can be moved with memcpy and never need destroying.
+		static bool IsZeroConstructibleAndTrivial( const Type& type )
+		{
+			const auto kind = type.GetKind();
+			return kind == ::rtti::Type::Kind::Primitive || kind == ::rtti::Type::Kind::Enum || kind == ::rtti::Type::Kind::RawPointer;
+		}
+
+		// Expects properties to be appended in the order of their offsets.
+		void AppendLifetimeOp( const ::rtti::Property& property )
+		{
+			const Type& type = property.GetType();
+			if ( !IsZeroConstructibleAndTrivial( type ) )
+			{
+				m_destroyedOps.push_back( m_lifetimeOps.size() );
+				m_lifetimeOps.push_back( { property.GetOffset(), type.GetSize(), &type } );
+				return;
+			}
+
+			// Padding between trivial properties is merged into the span too.
+			if ( !m_lifetimeOps.empty() && !m_lifetimeOps.back().m_type )
+			{
+				auto& span = m_lifetimeOps.back();
+				span.m_size = property.GetOffset() + type.GetSize() - span.m_offset;
+				return;
+			}
+
+			m_lifetimeOps.push_back( { property.GetOffset(), type.GetSize(), nullptr } );
+		}
+
+		void RebuildLifetimeOps()
+		{
+			m_lifetimeOps.clear();
+			m_destroyedOps.clear();
+
+			std::vector< const ::rtti::Property* > properties;
+			properties.reserve( m_properties.size() );
+			for ( const auto& property : m_properties )
+			{
+				properties.push_back( &property );
+			}
+
+			std::sort( properties.begin(), properties.end(), []( const ::rtti::Property* lhs, const ::rtti::Property* rhs ) { return lhs->GetOffset() < rhs->GetOffset(); } );
+			for ( const auto* property : properties )
+			{
+				AppendLifetimeOp( *property );
+			}
+		}
+
+		// Construction, move and destruction plan of own properties.
+		struct LifetimeOp
+		{
+			size_t m_offset = 0u;
+			size_t m_size = 0u;
+			// Null for spans of trivial properties, which are zeroed on construction and copied on move.
+			const Type* m_type = nullptr;
+		};
+
+		// Interned.
+		std::string_view m_name;
 		std::vector< ::rtti::Property > m_properties;
 		size_t m_size = 0;
 		size_t m_alignment =  0;
+
+		// Between BeginLayout() and FinalizeLayout(), groups of properties starting from m_firstLaidOutProperty.
+		bool m_layoutStarted = false;
+		size_t m_firstLaidOutProperty = 0u;
+		std::vector< LayoutGroup > m_layoutGroups;
+
+		std::vector< LifetimeOp > m_lifetimeOps;
+		// Indices of m_lifetimeOps which aren't trivial spans.
+		std::vector< size_t > m_destroyedOps;
 	};
 }
 #pragma endregion
@@ -2593,6 +4032,10 @@ namespace rtti
 		virtual const void* GetPointedAddress( const void* address ) const = 0;
 		virtual void SetPointedAddress( void* address, void* pointedAddress ) const = 0;
 		virtual void AssignSharedPtr( void* src, void* dest ) const = 0;
+		virtual std::shared_ptr< void > GetSharedPointer( const void* address ) const = 0;
+
+		// Shares ownership with owner, but points to pointedAddress.
+		virtual void SetSharedPointer( void* address, const std::shared_ptr< void >& owner, void* pointedAddress ) const = 0;
 
 		virtual InternalTypeDesc GetInternalTypeDesc() const = 0;
 
@@ -2646,6 +4089,17 @@ namespace rtti
 			*destShared = *srcShared;
 		}
 
+		virtual std::shared_ptr< void > GetSharedPointer( const void* address ) const override
+		{
+			return std::const_pointer_cast< TNonConst >( *static_cast< const std::shared_ptr< T >* >( address ) );
+		}
+
+		virtual void SetSharedPointer( void* address, const std::shared_ptr< void >& owner, void* pointedAddress ) const override
+		{
+			auto* ptr = static_cast< std::shared_ptr< TNonConst >* >( address );
+			*ptr = std::shared_ptr< TNonConst >( owner, static_cast< TNonConst* >( pointedAddress ) );
+		}
+
 	private:
 		static std::array< InternalTypeDesc, 1 > GetInternalTypeDescsStatic()
 		{
@@ -2782,8 +4236,7 @@ namespace rtti
 
 		static const StringType& GetInstance()
 		{
-			static const StringType& s_typeInstance = ::rtti::RTTI::GetMutable().GetOrRegisterType< StringType >();
-			return s_typeInstance;
+			return ::rtti::internal::GetOrRegisterTypeInstance< StringType >();
 		}
 
 	private:
@@ -2802,23 +4255,27 @@ namespace rtti
 	template< class TDest, class TSource >
 	TDest* Cast( TSource* source )
 	{
-		if ( TDest::GetTypeStatic().InheritsFromOrIsA< TSource >() )
+		if constexpr ( std::remove_const_t< TDest >::template InheritsFromOrIsAStatic< TSource >() )
 		{
 			return static_cast< TDest* >( source );
 		}
-
-		return nullptr;
+		else
+		{
+			return nullptr;
+		}
 	}
 
 	template< class TDest, class TSource >
 	const TDest* Cast( const TSource* source )
 	{
-		if ( TDest::GetTypeStatic().InheritsFromOrIsA< TSource >() )
+		if constexpr ( std::remove_const_t< TDest >::template InheritsFromOrIsAStatic< TSource >() )
 		{
 			return static_cast< const TDest* >( source );
 		}
-
-		return nullptr;
+		else
+		{
+			return nullptr;
+		}
 	}
 
 	template< class TDest, class TSource >
@@ -2877,4 +4334,6282 @@ namespace rtti
 		throw;
 	}
 }
+#pragma endregion
+
+#pragma region TypePlan
+namespace rtti
+{
+	namespace internal
+	{
+		// Flattened description of type's memory. Adjacent trivially copyable properties are merged into single Copy ops,
+		// nested structs are inlined and everything that requires special handling becomes an explicit op.
+		class TypePlan
+		{
+		public:
+			enum class OpKind : uint8_t
+			{
+				Copy,
+				String,
+				Container,
+				UniquePointer,
+				SharedPointer,
+				RawPointer
+			};
+
+			struct Op
+			{
+				OpKind m_kind = OpKind::Copy;
+				size_t m_offset = 0u;
+				size_t m_size = 0u;
+				const Type* m_type = nullptr;
+				const TypePlan* m_internalPlan = nullptr;
+			};
+
+			// Locks only when the plan has to be compiled. Plans of runtime types are recompiled after properties of any runtime type change.
+			static const TypePlan& Get( const Type& type )
+			{
+				const TypePlan* publishedPlan = type.m_plan.load( std::memory_order_acquire );
+				if ( publishedPlan && !publishedPlan->IsStale() )
+				{
+					return *publishedPlan;
+				}
+
+				std::lock_guard< std::mutex > lock( GetMutex() );
+				const TypePlan& plan = GetOrCompile( type );
+				for ( TypePlan* compiledPlan : GetUnpublishedPlans() )
+				{
+					compiledPlan->m_type.m_plan.store( compiledPlan, std::memory_order_release );
+				}
+
+				GetUnpublishedPlans().clear();
+				return plan;
+			}
+
+			const Type& GetType() const
+			{
+				return m_type;
+			}
+
+			const std::vector< Op >& GetOps() const
+			{
+				return m_ops;
+			}
+
+			// True if the whole object might be copied with a single memcpy.
+			bool IsTriviallyCopyable() const
+			{
+				return m_isTriviallyCopyable;
+			}
+
+		private:
+			TypePlan( const Type& type )
+				: m_type( type )
+				, m_isRuntimeType( type.GetKind() == Type::Kind::RuntimeType )
+				, m_runtimeLayoutsVersion( GetRuntimeLayoutsVersion().load( std::memory_order_acquire ) )
+			{}
+
+			// Only runtime types change after registration and only they embed other runtime types.
+			bool IsStale() const
+			{
+				return m_isRuntimeType && m_runtimeLayoutsVersion != GetRuntimeLayoutsVersion().load( std::memory_order_acquire );
+			}
+
+			static std::mutex& GetMutex()
+			{
+				static std::mutex s_mutex;
+				return s_mutex;
+			}
+
+			// Latest plans of types.
+			static std::unordered_map< const Type*, TypePlan* >& GetPlans()
+			{
+				static std::unordered_map< const Type*, TypePlan* > s_plans;
+				return s_plans;
+			}
+
+			// Stale plans are kept as well, they might be still in use by other threads.
+			static std::vector< std::unique_ptr< TypePlan > >& GetOwnedPlans()
+			{
+				static std::vector< std::unique_ptr< TypePlan > > s_ownedPlans;
+				return s_ownedPlans;
+			}
+
+			// Plans compiled by the current Get() call, nested plans might be referenced before they are complete.
+			static std::vector< TypePlan* >& GetUnpublishedPlans()
+			{
+				static std::vector< TypePlan* > s_unpublishedPlans;
+				return s_unpublishedPlans;
+			}
+
+			static const TypePlan& GetOrCompile( const Type& type )
+			{
+				auto& plans = GetPlans();
+				auto found = plans.find( &type );
+				if ( found != plans.end() && !found->second->IsStale() )
+				{
+					return *found->second;
+				}
+
+				// Registered before compiling to make self referencing types (e.g. through containers) possible.
+				TypePlan* plan = GetOwnedPlans().emplace_back( new TypePlan( type ) ).get();
+				plans[ &type ] = plan;
+				GetUnpublishedPlans().push_back( plan );
+
+				AppendOps( type, 0u, plan->m_ops );
+				plan->m_isTriviallyCopyable = IsSingleCopy( plan->m_ops, type );
+				return *plan;
+			}
+
+			static bool IsSingleCopy( const std::vector< Op >& ops, const Type& type )
+			{
+				return ops.size() == 1u && ops[ 0u ].m_kind == OpKind::Copy && ops[ 0u ].m_offset == 0u && ops[ 0u ].m_size == type.GetSize();
+			}
+
+			static void AppendCopy( std::vector< Op >& ops, size_t offset, size_t size )
+			{
+				if ( !ops.empty() && ops.back().m_kind == OpKind::Copy && ops.back().m_offset + ops.back().m_size == offset )
+				{
+					ops.back().m_size += size;
+					return;
+				}
+
+				Op op;
+				op.m_kind = OpKind::Copy;
+				op.m_offset = offset;
+				op.m_size = size;
+				ops.emplace_back( op );
+			}
+
+			static void AppendOp( std::vector< Op >& ops, OpKind kind, size_t offset, const Type& type, const TypePlan* internalPlan )
+			{
+				Op op;
+				op.m_kind = kind;
+				op.m_offset = offset;
+				op.m_size = type.GetSize();
+				op.m_type = &type;
+				op.m_internalPlan = internalPlan;
+				ops.emplace_back( op );
+			}
+
+			static void AppendOps( const Type& type, size_t offset, std::vector< Op >& ops )
+			{
+				switch ( type.GetKind() )
+				{
+				case Type::Kind::Primitive:
+				case Type::Kind::Enum:
+					AppendCopy( ops, offset, type.GetSize() );
+					break;
+
+				case Type::Kind::String:
+					AppendOp( ops, OpKind::String, offset, type, nullptr );
+					break;
+
+				case Type::Kind::RawPointer:
+					AppendOp( ops, OpKind::RawPointer, offset, type, nullptr );
+					break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Type::Kind::UniquePointer:
+					AppendOp( ops, OpKind::UniquePointer, offset, type, &GetOrCompile( static_cast< const UniquePtrBaseType& >( type ).GetInternalTypeDesc().GetType() ) );
+					break;
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Type::Kind::SharedPointer:
+					AppendOp( ops, OpKind::SharedPointer, offset, type, &GetOrCompile( static_cast< const SharedPtrBaseType& >( type ).GetInternalTypeDesc().GetType() ) );
+					break;
+#endif
+
+				case Type::Kind::Array:
+				{
+					const Type& elementType = static_cast< const ContainerType& >( type ).GetInternalTypeDesc().GetType();
+
+					// Can't rely on the cached element's plan here, it might be still in compilation.
+					std::vector< Op > elementOps;
+					AppendOps( elementType, 0u, elementOps );
+					if ( IsSingleCopy( elementOps, elementType ) )
+					{
+						AppendCopy( ops, offset, type.GetSize() );
+					}
+					else
+					{
+						AppendOp( ops, OpKind::Container, offset, type, &GetOrCompile( elementType ) );
+					}
+					break;
+				}
+
+				case Type::Kind::Vector:
+				case Type::Kind::Set:
+				case Type::Kind::Map:
+					AppendOp( ops, OpKind::Container, offset, type, &GetOrCompile( static_cast< const ContainerType& >( type ).GetInternalTypeDesc().GetType() ) );
+					break;
+
+				default:
+					assert( type.IsLayoutFinalized() && "Layout of the runtime type has to be finalized first." );
+					for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+					{
+						const Property* property = type.GetProperty( i );
+						AppendOps( property->GetType(), offset + property->GetOffset(), ops );
+					}
+					break;
+				}
+			}
+
+			const Type& m_type;
+			std::vector< Op > m_ops;
+			bool m_isTriviallyCopyable = false;
+			bool m_isRuntimeType = false;
+			uint64 m_runtimeLayoutsVersion = 0u;
+		};
+	}
+}
+#pragma endregion
+
+#pragma region BinarySerializer
+namespace rtti
+{
+	namespace internal
+	{
+		class BinaryStreamWriter
+		{
+		public:
+			BinaryStreamWriter( std::vector< uint8_t >& buffer )
+				: m_buffer( buffer )
+			{}
+
+			void Write( const void* data, size_t size )
+			{
+				const uint8_t* bytes = static_cast< const uint8_t* >( data );
+				m_buffer.insert( m_buffer.end(), bytes, bytes + size );
+			}
+
+			template< class T >
+			void WriteValue( const T& value )
+			{
+				Write( &value, sizeof( T ) );
+			}
+
+			std::vector< uint8_t >& GetBuffer()
+			{
+				return m_buffer;
+			}
+
+		private:
+			std::vector< uint8_t >& m_buffer;
+		};
+
+		class BinaryStreamReader
+		{
+		public:
+			BinaryStreamReader( const uint8_t* data, size_t size )
+				: m_data( data )
+				, m_size( size )
+			{}
+
+			bool Read( void* destination, size_t size )
+			{
+				if ( size > GetRemainingSize() )
+				{
+					return false;
+				}
+
+				std::memcpy( destination, m_data + m_position, size );
+				m_position += size;
+				return true;
+			}
+
+			template< class T >
+			bool ReadValue( T& outValue )
+			{
+				return Read( &outValue, sizeof( T ) );
+			}
+
+			const uint8_t* Skip( size_t size )
+			{
+				if ( size > GetRemainingSize() )
+				{
+					return nullptr;
+				}
+
+				const uint8_t* result = m_data + m_position;
+				m_position += size;
+				return result;
+			}
+
+			size_t GetRemainingSize() const
+			{
+				return m_size - m_position;
+			}
+
+			size_t GetPosition() const
+			{
+				return m_position;
+			}
+
+		private:
+			const uint8_t* m_data = nullptr;
+			size_t m_size = 0u;
+			size_t m_position = 0u;
+		};
+
+		// Properly aligned memory for a single instance of type-erased element.
+		class ElementBuffer
+		{
+		public:
+			ElementBuffer( const Type& type )
+				: m_type( type )
+				, m_memory( ::operator new( type.GetSize(), std::align_val_t( type.GetAlignment() ) ) )
+			{}
+
+			~ElementBuffer()
+			{
+				::operator delete( m_memory, std::align_val_t( m_type.GetAlignment() ) );
+			}
+
+			ElementBuffer( const ElementBuffer& ) = delete;
+			ElementBuffer& operator=( const ElementBuffer& ) = delete;
+
+			void* Get() const
+			{
+				return m_memory;
+			}
+
+		private:
+			const Type& m_type;
+			void* m_memory = nullptr;
+		};
+
+		inline void WriteString( BinaryStreamWriter& writer, const std::string& str )
+		{
+			writer.WriteValue( static_cast< uint64 >( str.size() ) );
+			writer.Write( str.data(), str.size() );
+		}
+
+		inline bool ReadString( BinaryStreamReader& reader, std::string& outString )
+		{
+			uint64 length = 0u;
+			if ( !reader.ReadValue( length ) || length > reader.GetRemainingSize() )
+			{
+				return false;
+			}
+
+			outString.assign( reinterpret_cast< const char* >( reader.Skip( static_cast< size_t >( length ) ) ), static_cast< size_t >( length ) );
+			return true;
+		}
+
+		// Stored true type of a pointee, nullptr if it doesn't exist or doesn't inherit from the pointer's type.
+		inline const Type* FindPointeeType( const Type& internalType, ID typeId )
+		{
+			const Type* trueType = internalType.GetID() == typeId ? &internalType : ::rtti::Get().FindType( typeId );
+			if ( !trueType || ( *trueType != internalType && !trueType->InheritsFrom( internalType ) ) )
+			{
+				return nullptr;
+			}
+
+			return trueType;
+		}
+
+		// Amounts of elements which don't take any bytes (e.g. raw pointers) can't be checked against the remaining data.
+		inline constexpr uint64 c_maxZeroSizedElementsAmount = uint64( 1u ) << 24u;
+
+		// Every element takes at least minElementSize bytes, bigger amounts come from corrupted data.
+		inline bool IsElementsAmountValid( uint64 elementsAmount, size_t minElementSize, size_t remainingSize )
+		{
+			return minElementSize > 0u ? elementsAmount <= remainingSize / minElementSize : elementsAmount <= c_maxZeroSizedElementsAmount;
+		}
+
+		// Fills a cleared dynamic container with elements read one after another. Amounts of elements are validated with IsElementsAmountValid(). Elements of contiguous containers are loaded in place, trivially copyable ones at once,
+		// others are loaded through a temporary element.
+		template< class TLoadTrivial, class TLoadElement >
+		bool LoadDynamicContainer( uint8_t* address, const DynamicContainerType& type, uint64 elementsAmount, size_t minElementSize, bool isTriviallyCopyable,
+			BinaryStreamReader& reader, const TLoadTrivial& loadTrivial, const TLoadElement& loadElement )
+		{
+			if ( !IsElementsAmountValid( elementsAmount, minElementSize, reader.GetRemainingSize() ) )
+			{
+				return false;
+			}
+
+			if ( elementsAmount == 0u )
+			{
+				return true;
+			}
+
+			const Type& elementType = type.GetInternalTypeDesc().GetType();
+			const size_t elementSize = elementType.GetSize();
+			const size_t maxElementsAmount = std::min( static_cast< size_t >( elementsAmount ), reader.GetRemainingSize() / std::max< size_t >( minElementSize, 1u ) );
+			type.AddDefaultElement( address );
+			if ( type.GetData( address ) )
+			{
+				if ( isTriviallyCopyable )
+				{
+					type.AddDefaultElements( address, static_cast< size_t >( elementsAmount ) - 1u );
+					return loadTrivial( static_cast< uint8_t* >( type.GetData( address ) ), static_cast< size_t >( elementsAmount ) * elementSize );
+				}
+
+				type.Reserve( address, maxElementsAmount );
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					if ( i > 0u )
+					{
+						type.AddDefaultElement( address );
+					}
+
+					if ( !loadElement( static_cast< uint8_t* >( type.GetData( address ) ) + i * elementSize ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			type.Clear( address );
+			type.Reserve( address, maxElementsAmount );
+			ElementBuffer element( elementType );
+			for ( size_t i = 0u; i < elementsAmount; ++i )
+			{
+				elementType.ConstructInPlace( element.Get() );
+				const bool result = loadElement( static_cast< uint8_t* >( element.Get() ) );
+				if ( result )
+				{
+					type.EmplaceElement( address, element.Get() );
+				}
+
+				elementType.Destroy( element.Get() );
+				if ( !result )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	namespace internal
+	{
+		struct ParallelContext
+		{
+			uint32_t m_threadsAmount = 1u;
+		};
+
+		// Worker threads reused by all parallel operations. The calling thread always takes part in its job,
+		// so jobs progress even when all workers are busy with jobs of other threads.
+		class ThreadPool
+		{
+		public:
+			static ThreadPool& Get()
+			{
+				static ThreadPool s_instance;
+				return s_instance;
+			}
+
+			ThreadPool( const ThreadPool& ) = delete;
+			ThreadPool& operator=( const ThreadPool& ) = delete;
+
+			~ThreadPool()
+			{
+				{
+					std::lock_guard< std::mutex > lock( m_mutex );
+					m_stop = true;
+				}
+
+				m_jobQueued.notify_all();
+				for ( std::thread& thread : m_threads )
+				{
+					thread.join();
+				}
+			}
+
+			// Runs tasks on the calling thread and up to threadsAmount - 1 workers. The first exception thrown by a task stops
+			// starting new tasks and is rethrown on the calling thread once the running ones are finished.
+			template< class TFunc >
+			void Run( size_t tasksAmount, uint32_t threadsAmount, const TFunc& task )
+			{
+				if ( tasksAmount == 0u )
+				{
+					return;
+				}
+
+				Job job( tasksAmount, task );
+				const size_t helpersAmount = std::min< size_t >( std::max( threadsAmount, 1u ), tasksAmount ) - 1u;
+				if ( helpersAmount > 0u )
+				{
+					{
+						std::lock_guard< std::mutex > lock( m_mutex );
+						while ( m_threads.size() < helpersAmount )
+						{
+							m_threads.emplace_back( [ this ]() { WorkerLoop(); } );
+						}
+
+						m_queue.insert( m_queue.end(), helpersAmount, &job );
+					}
+
+					m_jobQueued.notify_all();
+				}
+
+				job.Work();
+				if ( helpersAmount > 0u )
+				{
+					// Helpers which haven't started yet aren't needed anymore.
+					std::unique_lock< std::mutex > lock( m_mutex );
+					m_queue.erase( std::remove( m_queue.begin(), m_queue.end(), &job ), m_queue.end() );
+					m_jobFinished.wait( lock, [ &job ]() { return job.m_activeHelpersAmount == 0u; } );
+				}
+
+				if ( job.m_exception )
+				{
+					std::rethrow_exception( job.m_exception );
+				}
+			}
+
+		private:
+			struct Job
+			{
+				Job( size_t tasksAmount, const std::function< void( size_t ) >& task )
+					: m_tasksAmount( tasksAmount )
+					, m_task( task )
+				{}
+
+				void Work()
+				{
+					for ( size_t i = m_nextTask++; i < m_tasksAmount; i = m_nextTask++ )
+					{
+						try
+						{
+							m_task( i );
+						}
+						catch ( ... )
+						{
+							std::lock_guard< std::mutex > lock( m_exceptionMutex );
+							if ( !m_exception )
+							{
+								m_exception = std::current_exception();
+							}
+
+							m_nextTask = m_tasksAmount;
+						}
+					}
+				}
+
+				const size_t m_tasksAmount = 0u;
+				std::function< void( size_t ) > m_task;
+				std::atomic< size_t > m_nextTask = 0u;
+				std::mutex m_exceptionMutex;
+				std::exception_ptr m_exception;
+
+				// Guarded by the pool's mutex.
+				size_t m_activeHelpersAmount = 0u;
+			};
+
+			ThreadPool() = default;
+
+			void WorkerLoop()
+			{
+				std::unique_lock< std::mutex > lock( m_mutex );
+				while ( true )
+				{
+					m_jobQueued.wait( lock, [ this ]() { return m_stop || !m_queue.empty(); } );
+					if ( m_stop )
+					{
+						return;
+					}
+
+					Job* job = m_queue.front();
+					m_queue.pop_front();
+					++job->m_activeHelpersAmount;
+
+					lock.unlock();
+					job->Work();
+					lock.lock();
+
+					if ( --job->m_activeHelpersAmount == 0u )
+					{
+						m_jobFinished.notify_all();
+					}
+				}
+			}
+
+			std::mutex m_mutex;
+			std::condition_variable m_jobQueued;
+			std::condition_variable m_jobFinished;
+			std::deque< Job* > m_queue;
+			std::vector< std::thread > m_threads;
+			bool m_stop = false;
+		};
+
+		template< class TFunc >
+		void RunParallel( size_t tasksAmount, uint32_t threadsAmount, const TFunc& task )
+		{
+			ThreadPool::Get().Run( tasksAmount, threadsAmount, task );
+		}
+	}
+
+	// Binary format based on compiled type plans. Data is stored in the native endianness and layout of primitives.
+	// Raw pointers are not serialized (they are loaded as nullptr), smart pointers store the ID of their pointee's true type.
+	class BinarySerializer
+	{
+	public:
+		static void Save( const void* address, const Type& type, std::vector< uint8_t >& outBuffer )
+		{
+			internal::BinaryStreamWriter writer( outBuffer );
+			SaveWithPlan( static_cast< const uint8_t* >( address ), internal::TypePlan::Get( type ), writer, nullptr );
+		}
+
+		template< class T >
+		static void Save( const T& object, std::vector< uint8_t >& outBuffer )
+		{
+			Save( &object, GetTypeInstanceOf< T >(), outBuffer );
+		}
+
+		// Returns false if data is corrupted or it doesn't match the type. Object is left in a valid but unspecified state in such case.
+		static bool Load( void* address, const Type& type, const uint8_t* data, size_t size, size_t* outReadSize = nullptr )
+		{
+			internal::BinaryStreamReader reader( data, size );
+			const bool result = LoadWithPlan( static_cast< uint8_t* >( address ), internal::TypePlan::Get( type ), reader, nullptr );
+			if ( outReadSize )
+			{
+				*outReadSize = reader.GetPosition();
+			}
+
+			return result;
+		}
+
+		template< class T >
+		static bool Load( T& object, const std::vector< uint8_t >& buffer )
+		{
+			return Load( &object, GetTypeInstanceOf< T >(), buffer.data(), buffer.size() );
+		}
+
+		// Large arrays and vectors are split into chunks saved on worker threads into independent buffers.
+		// The output is the same as the one of Save(), so both might be loaded with either Load() or LoadParallel().
+		static void SaveParallel( const void* address, const Type& type, std::vector< uint8_t >& outBuffer, uint32_t threadsAmount = std::thread::hardware_concurrency() )
+		{
+			internal::BinaryStreamWriter writer( outBuffer );
+			const internal::ParallelContext parallel{ threadsAmount };
+			SaveWithPlan( static_cast< const uint8_t* >( address ), internal::TypePlan::Get( type ), writer, &parallel );
+		}
+
+		template< class T >
+		static void SaveParallel( const T& object, std::vector< uint8_t >& outBuffer, uint32_t threadsAmount = std::thread::hardware_concurrency() )
+		{
+			SaveParallel( &object, GetTypeInstanceOf< T >(), outBuffer, threadsAmount );
+		}
+
+		static bool LoadParallel( void* address, const Type& type, const uint8_t* data, size_t size, uint32_t threadsAmount = std::thread::hardware_concurrency() )
+		{
+			internal::BinaryStreamReader reader( data, size );
+			const internal::ParallelContext parallel{ threadsAmount };
+			return LoadWithPlan( static_cast< uint8_t* >( address ), internal::TypePlan::Get( type ), reader, &parallel );
+		}
+
+		template< class T >
+		static bool LoadParallel( T& object, const std::vector< uint8_t >& buffer, uint32_t threadsAmount = std::thread::hardware_concurrency() )
+		{
+			return LoadParallel( &object, GetTypeInstanceOf< T >(), buffer.data(), buffer.size(), threadsAmount );
+		}
+
+	private:
+		friend class internal::Delta;
+		using Plan = internal::TypePlan;
+
+		static constexpr size_t c_minChunkElementsAmount = 1024u;
+		static constexpr size_t c_minChunkBytesAmount = 1024u * 1024u;
+		static constexpr size_t c_maxChunksAmount = 64u;
+
+		// Chunks' layout depends only on the data, never on the amount of threads.
+		static size_t GetChunksAmount( size_t amount, size_t minChunkAmount )
+		{
+			return std::min( amount / minChunkAmount, c_maxChunksAmount );
+		}
+
+		static size_t GetChunkBegin( size_t amount, size_t chunksAmount, size_t chunk )
+		{
+			return amount * chunk / chunksAmount;
+		}
+
+		static bool IsChunked( const ContainerType& type, const Plan& elementPlan, size_t elementsAmount, const internal::ParallelContext* parallel )
+		{
+			return parallel
+				&& ( type.GetKind() == Type::Kind::Array || type.GetKind() == Type::Kind::Vector )
+				&& !elementPlan.IsTriviallyCopyable()
+				&& GetChunksAmount( elementsAmount, c_minChunkElementsAmount ) > 1u;
+		}
+
+		// Trivially copyable data is copied in parallel straight to/from its final place, so it doesn't change the format.
+		static void CopyParallel( void* destination, const void* source, size_t size, const internal::ParallelContext& parallel )
+		{
+			const size_t chunksAmount = std::max< size_t >( GetChunksAmount( size, c_minChunkBytesAmount ), 1u );
+			internal::RunParallel( chunksAmount, parallel.m_threadsAmount, [ & ]( size_t chunk )
+				{
+					const size_t begin = GetChunkBegin( size, chunksAmount, chunk );
+					const size_t end = GetChunkBegin( size, chunksAmount, chunk + 1u );
+					std::memcpy( static_cast< uint8_t* >( destination ) + begin, static_cast< const uint8_t* >( source ) + begin, end - begin );
+				} );
+		}
+
+		static void SaveChunks( const uint8_t* data, size_t elementsAmount, const Plan& elementPlan, internal::BinaryStreamWriter& writer, const internal::ParallelContext& parallel )
+		{
+			const size_t elementSize = elementPlan.GetType().GetSize();
+			const size_t chunksAmount = GetChunksAmount( elementsAmount, c_minChunkElementsAmount );
+			std::vector< std::vector< uint8_t > > chunks( chunksAmount );
+			internal::RunParallel( chunksAmount, parallel.m_threadsAmount, [ & ]( size_t chunk )
+				{
+					internal::BinaryStreamWriter chunkWriter( chunks[ chunk ] );
+					const size_t end = GetChunkBegin( elementsAmount, chunksAmount, chunk + 1u );
+					for ( size_t i = GetChunkBegin( elementsAmount, chunksAmount, chunk ); i < end; ++i )
+					{
+						SaveWithPlan( data + i * elementSize, elementPlan, chunkWriter, nullptr );
+					}
+				} );
+
+			for ( const std::vector< uint8_t >& chunk : chunks )
+			{
+				writer.Write( chunk.data(), chunk.size() );
+			}
+		}
+
+		// Elements have to be already constructed. Boundaries of chunks are found by skipping their elements, which is much cheaper than loading them.
+		static bool LoadChunks( uint8_t* data, size_t elementsAmount, const Plan& elementPlan, internal::BinaryStreamReader& reader, const internal::ParallelContext& parallel )
+		{
+			const size_t elementSize = elementPlan.GetType().GetSize();
+			const size_t chunksAmount = GetChunksAmount( elementsAmount, c_minChunkElementsAmount );
+			std::vector< internal::BinaryStreamReader > chunkReaders;
+			chunkReaders.reserve( chunksAmount );
+			for ( size_t chunk = 0u; chunk < chunksAmount; ++chunk )
+			{
+				const uint8_t* chunkData = reader.Skip( 0u );
+				const size_t chunkBegin = reader.GetPosition();
+				const size_t end = GetChunkBegin( elementsAmount, chunksAmount, chunk + 1u );
+				for ( size_t i = GetChunkBegin( elementsAmount, chunksAmount, chunk ); i < end; ++i )
+				{
+					if ( !SkipWithPlan( elementPlan, reader ) )
+					{
+						return false;
+					}
+				}
+
+				chunkReaders.emplace_back( chunkData, reader.GetPosition() - chunkBegin );
+			}
+
+			std::atomic< bool > result = true;
+			internal::RunParallel( chunksAmount, parallel.m_threadsAmount, [ & ]( size_t chunk )
+				{
+					internal::BinaryStreamReader& chunkReader = chunkReaders[ chunk ];
+					const size_t end = GetChunkBegin( elementsAmount, chunksAmount, chunk + 1u );
+					for ( size_t i = GetChunkBegin( elementsAmount, chunksAmount, chunk ); i < end && result; ++i )
+					{
+						if ( !LoadWithPlan( data + i * elementSize, elementPlan, chunkReader, nullptr ) )
+						{
+							result = false;
+						}
+					}
+
+					if ( chunkReader.GetRemainingSize() != 0u )
+					{
+						result = false;
+					}
+				} );
+
+			return result;
+		}
+
+		static void SaveWithPlan( const uint8_t* address, const Plan& plan, internal::BinaryStreamWriter& writer, const internal::ParallelContext* parallel )
+		{
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				const uint8_t* opAddress = address + op.m_offset;
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Copy:
+					writer.Write( opAddress, op.m_size );
+					break;
+
+				case Plan::OpKind::String:
+					internal::WriteString( writer, *reinterpret_cast< const std::string* >( opAddress ) );
+					break;
+
+				case Plan::OpKind::Container:
+					SaveContainer( opAddress, static_cast< const ContainerType& >( *op.m_type ), *op.m_internalPlan, writer, parallel );
+					break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Plan::OpKind::UniquePointer:
+					SavePointee( static_cast< const UniquePtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), *op.m_internalPlan, writer, parallel );
+					break;
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Plan::OpKind::SharedPointer:
+					SavePointee( static_cast< const SharedPtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), *op.m_internalPlan, writer, parallel );
+					break;
+#endif
+
+				default:
+					break;
+				}
+			}
+		}
+
+		static void SaveContainer( const uint8_t* address, const ContainerType& type, const Plan& elementPlan, internal::BinaryStreamWriter& writer, const internal::ParallelContext* parallel )
+		{
+			const size_t elementsAmount = type.GetElementsAmount( address );
+			if ( type.GetKind() != Type::Kind::Array )
+			{
+				writer.WriteValue( static_cast< uint64 >( elementsAmount ) );
+			}
+
+			const void* data = type.GetData( address );
+			if ( data && elementPlan.IsTriviallyCopyable() )
+			{
+				const size_t size = elementsAmount * elementPlan.GetType().GetSize();
+				if ( parallel && size >= c_minChunkBytesAmount * 2u )
+				{
+					std::vector< uint8_t >& buffer = writer.GetBuffer();
+					const size_t offset = buffer.size();
+					buffer.resize( offset + size );
+					CopyParallel( buffer.data() + offset, data, size, *parallel );
+					return;
+				}
+
+				writer.Write( data, size );
+				return;
+			}
+
+			if ( IsChunked( type, elementPlan, elementsAmount, parallel ) )
+			{
+				SaveChunks( static_cast< const uint8_t* >( data ), elementsAmount, elementPlan, writer, *parallel );
+				return;
+			}
+
+			type.VisitElements( address, [ & ]( const void* element )
+				{
+					SaveWithPlan( static_cast< const uint8_t* >( element ), elementPlan, writer, parallel );
+					return VisitOutcome::Continue;
+				} );
+		}
+
+		static void SavePointee( const void* pointee, const Plan& internalPlan, internal::BinaryStreamWriter& writer, const internal::ParallelContext* parallel )
+		{
+			if ( !pointee )
+			{
+				writer.WriteValue( static_cast< ID >( 0u ) );
+				return;
+			}
+
+			const Type& trueType = internalPlan.GetType().GetTrueType( pointee );
+			writer.WriteValue( trueType.GetID() );
+			SaveWithPlan( static_cast< const uint8_t* >( pointee ), trueType == internalPlan.GetType() ? internalPlan : Plan::Get( trueType ), writer, parallel );
+		}
+
+		static bool LoadWithPlan( uint8_t* address, const Plan& plan, internal::BinaryStreamReader& reader, const internal::ParallelContext* parallel )
+		{
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				uint8_t* opAddress = address + op.m_offset;
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Copy:
+					if ( !reader.Read( opAddress, op.m_size ) )
+					{
+						return false;
+					}
+					break;
+
+				case Plan::OpKind::String:
+					if ( !internal::ReadString( reader, *reinterpret_cast< std::string* >( opAddress ) ) )
+					{
+						return false;
+					}
+					break;
+
+				case Plan::OpKind::Container:
+					if ( !LoadContainer( opAddress, static_cast< const ContainerType& >( *op.m_type ), *op.m_internalPlan, reader, parallel ) )
+					{
+						return false;
+					}
+					break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Plan::OpKind::UniquePointer:
+				{
+					const auto& pointerType = static_cast< const UniquePtrBaseType& >( *op.m_type );
+					if ( !LoadPointee( *op.m_internalPlan, reader, parallel, [ & ]( void* pointee ) { pointerType.SetPointedAddress( opAddress, pointee ); } ) )
+					{
+						return false;
+					}
+					break;
+				}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Plan::OpKind::SharedPointer:
+				{
+					const auto& pointerType = static_cast< const SharedPtrBaseType& >( *op.m_type );
+					if ( !LoadPointee( *op.m_internalPlan, reader, parallel, [ & ]( void* pointee ) { pointerType.SetPointedAddress( opAddress, pointee ); } ) )
+					{
+						return false;
+					}
+					break;
+				}
+#endif
+
+				case Plan::OpKind::RawPointer:
+					*reinterpret_cast< void** >( opAddress ) = nullptr;
+					break;
+
+				default:
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		static bool LoadContainer( uint8_t* address, const ContainerType& type, const Plan& elementPlan, internal::BinaryStreamReader& reader, const internal::ParallelContext* parallel )
+		{
+			const size_t elementSize = elementPlan.GetType().GetSize();
+			if ( type.GetKind() == Type::Kind::Array )
+			{
+				uint8_t* data = static_cast< uint8_t* >( type.GetData( address ) );
+				const size_t elementsAmount = type.GetElementsAmount( address );
+				if ( elementPlan.IsTriviallyCopyable() )
+				{
+					return ReadTrivial( data, elementsAmount * elementSize, reader, parallel );
+				}
+
+				if ( IsChunked( type, elementPlan, elementsAmount, parallel ) )
+				{
+					return LoadChunks( data, elementsAmount, elementPlan, reader, *parallel );
+				}
+
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					if ( !LoadWithPlan( data + i * elementSize, elementPlan, reader, parallel ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			uint64 elementsAmount = 0u;
+			if ( !reader.ReadValue( elementsAmount ) )
+			{
+				return false;
+			}
+
+			const auto& dynamicType = static_cast< const DynamicContainerType& >( type );
+			dynamicType.Clear( address );
+
+			if ( elementsAmount > 0u && IsChunked( type, elementPlan, static_cast< size_t >( elementsAmount ), parallel ) )
+			{
+				if ( !internal::IsElementsAmountValid( elementsAmount, GetMinEncodedSize( elementPlan ), reader.GetRemainingSize() ) )
+				{
+					return false;
+				}
+
+				dynamicType.AddDefaultElements( address, static_cast< size_t >( elementsAmount ) );
+				return LoadChunks( static_cast< uint8_t* >( type.GetData( address ) ), static_cast< size_t >( elementsAmount ), elementPlan, reader, *parallel );
+			}
+
+			return internal::LoadDynamicContainer( address, dynamicType, elementsAmount, GetMinEncodedSize( elementPlan ), elementPlan.IsTriviallyCopyable(), reader,
+				[ & ]( uint8_t* data, size_t size ) { return ReadTrivial( data, size, reader, parallel ); },
+				[ & ]( uint8_t* element ) { return LoadWithPlan( element, elementPlan, reader, parallel ); } );
+		}
+
+		// Advances the reader past an instance without loading it.
+		static bool SkipWithPlan( const Plan& plan, internal::BinaryStreamReader& reader )
+		{
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Copy:
+					if ( !reader.Skip( op.m_size ) )
+					{
+						return false;
+					}
+					break;
+
+				case Plan::OpKind::String:
+				{
+					uint64 length = 0u;
+					if ( !reader.ReadValue( length ) || length > reader.GetRemainingSize() )
+					{
+						return false;
+					}
+
+					reader.Skip( static_cast< size_t >( length ) );
+					break;
+				}
+
+				case Plan::OpKind::Container:
+				{
+					const Plan& elementPlan = *op.m_internalPlan;
+					const size_t elementSize = elementPlan.GetType().GetSize();
+					uint64 elementsAmount = op.m_size / elementSize;
+					if ( op.m_type->GetKind() != Type::Kind::Array && !reader.ReadValue( elementsAmount ) )
+					{
+						return false;
+					}
+
+					if ( elementPlan.IsTriviallyCopyable() )
+					{
+						if ( elementsAmount > reader.GetRemainingSize() / elementSize || !reader.Skip( static_cast< size_t >( elementsAmount ) * elementSize ) )
+						{
+							return false;
+						}
+						break;
+					}
+
+					if ( !internal::IsElementsAmountValid( elementsAmount, GetMinEncodedSize( elementPlan ), reader.GetRemainingSize() ) )
+					{
+						return false;
+					}
+
+					for ( uint64 i = 0u; i < elementsAmount; ++i )
+					{
+						if ( !SkipWithPlan( elementPlan, reader ) )
+						{
+							return false;
+						}
+					}
+					break;
+				}
+
+				case Plan::OpKind::UniquePointer:
+				case Plan::OpKind::SharedPointer:
+				{
+					ID typeId = 0u;
+					if ( !reader.ReadValue( typeId ) )
+					{
+						return false;
+					}
+
+					if ( typeId == 0u )
+					{
+						break;
+					}
+
+					const Type* trueType = internal::FindPointeeType( op.m_internalPlan->GetType(), typeId );
+					if ( !trueType || !SkipWithPlan( *trueType == op.m_internalPlan->GetType() ? *op.m_internalPlan : Plan::Get( *trueType ), reader ) )
+					{
+						return false;
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		// Lower bound of the amount of bytes taken by an instance, elements of containers can't be trusted to take more.
+		static size_t GetMinEncodedSize( const Plan& plan )
+		{
+			size_t size = 0u;
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Copy:
+					size += op.m_size;
+					break;
+
+				case Plan::OpKind::String:
+					size += sizeof( uint64 );
+					break;
+
+				case Plan::OpKind::Container:
+					size += op.m_type->GetKind() == Type::Kind::Array ? 0u : sizeof( uint64 );
+					break;
+
+				case Plan::OpKind::UniquePointer:
+				case Plan::OpKind::SharedPointer:
+					size += sizeof( ID );
+					break;
+
+				default:
+					break;
+				}
+			}
+
+			return size;
+		}
+
+		static bool ReadTrivial( void* destination, size_t size, internal::BinaryStreamReader& reader, const internal::ParallelContext* parallel )
+		{
+			if ( !parallel || size < c_minChunkBytesAmount * 2u )
+			{
+				return reader.Read( destination, size );
+			}
+
+			const uint8_t* source = reader.Skip( size );
+			if ( !source )
+			{
+				return false;
+			}
+
+			CopyParallel( destination, source, size, *parallel );
+			return true;
+		}
+
+		template< class TSetter >
+		static bool LoadPointee( const Plan& internalPlan, internal::BinaryStreamReader& reader, const internal::ParallelContext* parallel, const TSetter& setter )
+		{
+			ID typeId = 0u;
+			if ( !reader.ReadValue( typeId ) )
+			{
+				return false;
+			}
+
+			if ( typeId == 0u )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			const Type& internalType = internalPlan.GetType();
+			const Type* trueType = internal::FindPointeeType( internalType, typeId );
+			if ( !trueType )
+			{
+				return false;
+			}
+
+			void* pointee = trueType->Construct();
+			if ( !pointee )
+			{
+				return false;
+			}
+
+			setter( pointee );
+			return LoadWithPlan( static_cast< uint8_t* >( pointee ), *trueType == internalType ? internalPlan : Plan::Get( *trueType ), reader, parallel );
+		}
+	};
+}
+#pragma endregion
+
+#pragma region VersionedBinarySerializer
+namespace rtti
+{
+	// Schema tolerant binary format. Writer appends a schema of every serialized class (persistent IDs of its properties and their types)
+	// and reader remaps stored properties onto the live type. Removed properties are skipped and new ones are reset to their default values.
+	// Layout: [magic][root type ID][payload][schemas][schemas offset]
+	class VersionedBinarySerializer
+	{
+	public:
+		static void Save( const void* address, const Type& type, std::vector< uint8_t >& outBuffer )
+		{
+			const size_t start = outBuffer.size();
+			internal::BinaryStreamWriter writer( outBuffer );
+			writer.WriteValue( c_magic );
+			writer.WriteValue( type.GetID() );
+
+			SaveContext context{ writer };
+			SaveValue( static_cast< const uint8_t* >( address ), type, context );
+
+			const uint64 schemasOffset = static_cast< uint64 >( outBuffer.size() - start );
+			writer.WriteValue( static_cast< uint32_t >( context.m_schemas.size() ) );
+			for ( const Schema* schema : context.m_schemas )
+			{
+				writer.WriteValue( schema->m_typeId );
+				writer.WriteValue( static_cast< uint32_t >( schema->m_properties.size() ) );
+				for ( const SchemaProperty& property : schema->m_properties )
+				{
+					writer.WriteValue( property.m_id );
+					writer.WriteValue( property.m_typeId );
+					writer.WriteValue( property.m_fixedSize );
+				}
+			}
+			writer.WriteValue( schemasOffset );
+		}
+
+		template< class T >
+		static void Save( const T& object, std::vector< uint8_t >& outBuffer )
+		{
+			Save( &object, GetTypeInstanceOf< T >(), outBuffer );
+		}
+
+		static bool Load( void* address, const Type& type, const uint8_t* data, size_t size )
+		{
+			constexpr size_t headerSize = sizeof( c_magic ) + sizeof( ID );
+			if ( size < headerSize + sizeof( uint64 ) )
+			{
+				return false;
+			}
+
+			uint32_t magic = 0u;
+			ID rootTypeId = 0u;
+			uint64 schemasOffset = 0u;
+			std::memcpy( &magic, data, sizeof( magic ) );
+			std::memcpy( &rootTypeId, data + sizeof( magic ), sizeof( rootTypeId ) );
+			std::memcpy( &schemasOffset, data + size - sizeof( schemasOffset ), sizeof( schemasOffset ) );
+			if ( magic != c_magic || rootTypeId != type.GetID() || schemasOffset < headerSize || schemasOffset > size - sizeof( schemasOffset ) )
+			{
+				return false;
+			}
+
+			LoadContext context;
+			if ( !ReadSchemas( internal::BinaryStreamReader( data + schemasOffset, size - sizeof( schemasOffset ) - static_cast< size_t >( schemasOffset ) ), context ) )
+			{
+				return false;
+			}
+
+			internal::BinaryStreamReader reader( data + headerSize, static_cast< size_t >( schemasOffset ) - headerSize );
+			return LoadValue( static_cast< uint8_t* >( address ), type, reader, context );
+		}
+
+		template< class T >
+		static bool Load( T& object, const std::vector< uint8_t >& buffer )
+		{
+			return Load( &object, GetTypeInstanceOf< T >(), buffer.data(), buffer.size() );
+		}
+
+	private:
+		static constexpr uint32_t c_magic = 0x56545452; // "RTTV"
+
+		struct SchemaProperty
+		{
+			ID m_id = 0u;
+			ID m_typeId = 0u;
+			uint32_t m_fixedSize = 0u; // 0 for properties stored with a length prefix
+		};
+
+		struct Schema
+		{
+			ID m_typeId = 0u;
+			ID m_hash = 0u;
+			std::vector< SchemaProperty > m_properties;
+		};
+
+		// Live type's schema with the ops used for writing it. Adjacent fixed size properties are written at once.
+		struct Layout
+		{
+			struct Op
+			{
+				size_t m_offset = 0u;
+				size_t m_fixedSize = 0u;
+				const Type* m_type = nullptr;
+			};
+
+			Schema m_schema;
+			std::vector< Op > m_ops;
+			uint64 m_runtimeLayoutsVersion = 0u;
+		};
+
+		// Describes how to read stored schema into the live type.
+		struct RemapPlan
+		{
+			enum class OpKind : uint8_t
+			{
+				Copy,
+				Skip,
+				Read,
+				SkipVariable,
+				Reset
+			};
+
+			struct Op
+			{
+				OpKind m_kind = OpKind::Copy;
+				size_t m_offset = 0u;
+				size_t m_size = 0u;
+				const Type* m_type = nullptr;
+			};
+
+			std::vector< Op > m_ops;
+			uint64 m_runtimeLayoutsVersion = 0u;
+		};
+
+		struct SaveContext
+		{
+			internal::BinaryStreamWriter& m_writer;
+			std::vector< const Schema* > m_schemas;
+			std::unordered_map< ID, const Layout* > m_layouts;
+		};
+
+		struct LoadContext
+		{
+			std::unordered_map< ID, Schema > m_schemas;
+			std::unordered_map< ID, const RemapPlan* > m_remapPlans;
+		};
+
+		static bool IsFixedSize( const Type& type )
+		{
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+			case Type::Kind::Enum:
+				return true;
+			case Type::Kind::Array:
+				return IsFixedSize( static_cast< const ContainerType& >( type ).GetInternalTypeDesc().GetType() );
+			default:
+				return false;
+			}
+		}
+
+		static bool IsClassLike( const Type& type )
+		{
+			const Type::Kind kind = type.GetKind();
+			return kind == Type::Kind::Class || kind == Type::Kind::Struct || kind == Type::Kind::RuntimeType;
+		}
+
+		static std::mutex& GetMutex()
+		{
+			static std::mutex s_mutex;
+			return s_mutex;
+		}
+
+		// Layouts and remap plans of runtime types are rebuilt after properties of any runtime type change.
+		static bool IsStale( const Type& type, uint64 runtimeLayoutsVersion )
+		{
+			return type.GetKind() == Type::Kind::RuntimeType && runtimeLayoutsVersion != internal::GetRuntimeLayoutsVersion().load( std::memory_order_acquire );
+		}
+
+		// Replaced layouts and plans are kept, other saves and loads might still use them.
+		template< class T >
+		static T* CreateOwned()
+		{
+			static std::vector< std::unique_ptr< T > > s_owned;
+			T* created = s_owned.emplace_back( std::make_unique< T >() ).get();
+			created->m_runtimeLayoutsVersion = internal::GetRuntimeLayoutsVersion().load( std::memory_order_acquire );
+			return created;
+		}
+
+		static const Layout& GetLayout( const Type& type )
+		{
+			static std::unordered_map< const Type*, Layout* > s_layouts;
+
+			std::lock_guard< std::mutex > lock( GetMutex() );
+			Layout*& layout = s_layouts[ &type ];
+			if ( layout && !IsStale( type, layout->m_runtimeLayoutsVersion ) )
+			{
+				return *layout;
+			}
+
+			assert( type.IsLayoutFinalized() && "Layout of the runtime type has to be finalized first." );
+			layout = CreateOwned< Layout >();
+			layout->m_schema.m_typeId = type.GetID();
+			for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+			{
+				const Property* property = type.GetProperty( i );
+				const Type& propertyType = property->GetType();
+				const uint32_t fixedSize = IsFixedSize( propertyType ) ? static_cast< uint32_t >( propertyType.GetSize() ) : 0u;
+				layout->m_schema.m_properties.push_back( { property->GetID(), propertyType.GetID(), fixedSize } );
+
+				auto& ops = layout->m_ops;
+				if ( fixedSize > 0u && !ops.empty() && ops.back().m_fixedSize > 0u && ops.back().m_offset + ops.back().m_fixedSize == property->GetOffset() )
+				{
+					ops.back().m_fixedSize += fixedSize;
+				}
+				else
+				{
+					ops.push_back( { property->GetOffset(), fixedSize, &propertyType } );
+				}
+			}
+
+			layout->m_schema.m_hash = CalcSchemaHash( layout->m_schema );
+			return *layout;
+		}
+
+		static ID CalcSchemaHash( const Schema& schema )
+		{
+			ID hash = schema.m_typeId;
+			for ( const SchemaProperty& property : schema.m_properties )
+			{
+				hash = hash * 31u + property.m_id;
+				hash = hash * 31u + property.m_typeId;
+				hash = hash * 31u + property.m_fixedSize;
+			}
+
+			return hash;
+		}
+
+		static const RemapPlan& GetRemapPlan( const Schema& schema, const Type& liveType )
+		{
+			// Per live type, per schema hash.
+			static std::unordered_map< const Type*, std::unordered_map< ID, RemapPlan* > > s_plans;
+
+			std::lock_guard< std::mutex > lock( GetMutex() );
+			RemapPlan*& plan = s_plans[ &liveType ][ schema.m_hash ];
+			if ( plan && !IsStale( liveType, plan->m_runtimeLayoutsVersion ) )
+			{
+				return *plan;
+			}
+
+			plan = CreateOwned< RemapPlan >();
+
+			std::vector< const Property* > matchedProperties;
+			std::vector< RemapPlan::Op > ops;
+			for ( const SchemaProperty& storedProperty : schema.m_properties )
+			{
+				const Property* liveProperty = liveType.FindProperty( storedProperty.m_id );
+				const bool matches = liveProperty
+					&& liveProperty->GetType().GetID() == storedProperty.m_typeId
+					&& ( IsFixedSize( liveProperty->GetType() ) ? liveProperty->GetType().GetSize() : 0u ) == storedProperty.m_fixedSize;
+
+				if ( matches )
+				{
+					matchedProperties.emplace_back( liveProperty );
+					if ( storedProperty.m_fixedSize > 0u )
+					{
+						if ( !ops.empty() && ops.back().m_kind == RemapPlan::OpKind::Copy && ops.back().m_offset + ops.back().m_size == liveProperty->GetOffset() )
+						{
+							ops.back().m_size += storedProperty.m_fixedSize;
+						}
+						else
+						{
+							ops.push_back( { RemapPlan::OpKind::Copy, liveProperty->GetOffset(), storedProperty.m_fixedSize, nullptr } );
+						}
+					}
+					else
+					{
+						ops.push_back( { RemapPlan::OpKind::Read, liveProperty->GetOffset(), 0u, &liveProperty->GetType() } );
+					}
+				}
+				else if ( storedProperty.m_fixedSize > 0u )
+				{
+					if ( !ops.empty() && ops.back().m_kind == RemapPlan::OpKind::Skip )
+					{
+						ops.back().m_size += storedProperty.m_fixedSize;
+					}
+					else
+					{
+						ops.push_back( { RemapPlan::OpKind::Skip, 0u, storedProperty.m_fixedSize, nullptr } );
+					}
+				}
+				else
+				{
+					ops.push_back( { RemapPlan::OpKind::SkipVariable, 0u, 0u, nullptr } );
+				}
+			}
+
+			for ( size_t i = 0u; i < liveType.GetPropertiesAmount(); ++i )
+			{
+				const Property* liveProperty = liveType.GetProperty( i );
+				if ( std::find( matchedProperties.begin(), matchedProperties.end(), liveProperty ) == matchedProperties.end() )
+				{
+					plan->m_ops.push_back( { RemapPlan::OpKind::Reset, liveProperty->GetOffset(), 0u, &liveProperty->GetType() } );
+				}
+			}
+
+			plan->m_ops.insert( plan->m_ops.end(), ops.begin(), ops.end() );
+			return *plan;
+		}
+
+		static size_t BeginLengthPrefix( internal::BinaryStreamWriter& writer )
+		{
+			const size_t position = writer.GetBuffer().size();
+			writer.WriteValue( static_cast< uint64 >( 0u ) );
+			return position;
+		}
+
+		static void EndLengthPrefix( internal::BinaryStreamWriter& writer, size_t position )
+		{
+			const uint64 length = static_cast< uint64 >( writer.GetBuffer().size() - position - sizeof( uint64 ) );
+			std::memcpy( writer.GetBuffer().data() + position, &length, sizeof( length ) );
+		}
+
+		static void SaveValue( const uint8_t* address, const Type& type, SaveContext& context )
+		{
+			internal::BinaryStreamWriter& writer = context.m_writer;
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+			case Type::Kind::Enum:
+				writer.Write( address, type.GetSize() );
+				break;
+
+			case Type::Kind::String:
+				internal::WriteString( writer, *reinterpret_cast< const std::string* >( address ) );
+				break;
+
+			case Type::Kind::RawPointer:
+				break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), context );
+				break;
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), context );
+				break;
+			}
+#endif
+
+			case Type::Kind::Array:
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& elementType = containerType.GetInternalTypeDesc().GetType();
+				const size_t elementsAmount = containerType.GetElementsAmount( address );
+				if ( type.GetKind() != Type::Kind::Array )
+				{
+					writer.WriteValue( static_cast< uint64 >( elementsAmount ) );
+				}
+
+				const void* data = containerType.GetData( address );
+				if ( data && IsFixedSize( elementType ) )
+				{
+					writer.Write( data, elementsAmount * elementType.GetSize() );
+					break;
+				}
+
+				containerType.VisitElements( address, [ & ]( const void* element )
+					{
+						SaveValue( static_cast< const uint8_t* >( element ), elementType, context );
+						return VisitOutcome::Continue;
+					} );
+				break;
+			}
+
+			default:
+			{
+				const Layout& layout = GetLayout( type );
+				if ( context.m_layouts.emplace( type.GetID(), &layout ).second )
+				{
+					context.m_schemas.emplace_back( &layout.m_schema );
+				}
+
+				for ( const Layout::Op& op : layout.m_ops )
+				{
+					if ( op.m_fixedSize > 0u )
+					{
+						writer.Write( address + op.m_offset, op.m_fixedSize );
+					}
+					else
+					{
+						const size_t lengthPosition = BeginLengthPrefix( writer );
+						SaveValue( address + op.m_offset, *op.m_type, context );
+						EndLengthPrefix( writer, lengthPosition );
+					}
+				}
+				break;
+			}
+			}
+		}
+
+		static void SavePointee( const void* pointee, const Type& internalType, SaveContext& context )
+		{
+			if ( !pointee )
+			{
+				context.m_writer.WriteValue( static_cast< ID >( 0u ) );
+				return;
+			}
+
+			const Type& trueType = internalType.GetTrueType( pointee );
+			context.m_writer.WriteValue( trueType.GetID() );
+			const size_t lengthPosition = BeginLengthPrefix( context.m_writer );
+			SaveValue( static_cast< const uint8_t* >( pointee ), trueType, context );
+			EndLengthPrefix( context.m_writer, lengthPosition );
+		}
+
+		static bool ReadSchemas( internal::BinaryStreamReader reader, LoadContext& context )
+		{
+			uint32_t schemasAmount = 0u;
+			if ( !reader.ReadValue( schemasAmount ) )
+			{
+				return false;
+			}
+
+			for ( uint32_t i = 0u; i < schemasAmount; ++i )
+			{
+				Schema schema;
+				uint32_t propertiesAmount = 0u;
+				if ( !reader.ReadValue( schema.m_typeId ) || !reader.ReadValue( propertiesAmount ) )
+				{
+					return false;
+				}
+
+				constexpr size_t propertySize = sizeof( ID ) * 2u + sizeof( uint32_t );
+				if ( propertiesAmount > reader.GetRemainingSize() / propertySize )
+				{
+					return false;
+				}
+
+				schema.m_properties.resize( propertiesAmount );
+				for ( SchemaProperty& property : schema.m_properties )
+				{
+					reader.ReadValue( property.m_id );
+					reader.ReadValue( property.m_typeId );
+					reader.ReadValue( property.m_fixedSize );
+				}
+
+				schema.m_hash = CalcSchemaHash( schema );
+				context.m_schemas.emplace( schema.m_typeId, std::move( schema ) );
+			}
+
+			return true;
+		}
+
+		static bool ResetValue( uint8_t* address, const Type& type )
+		{
+			type.Destroy( address );
+			type.ConstructInPlace( address );
+			return true;
+		}
+
+		static bool LoadValue( uint8_t* address, const Type& type, internal::BinaryStreamReader& reader, LoadContext& context )
+		{
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+			case Type::Kind::Enum:
+				return reader.Read( address, type.GetSize() );
+
+			case Type::Kind::String:
+				return internal::ReadString( reader, *reinterpret_cast< std::string* >( address ) );
+
+			case Type::Kind::RawPointer:
+				*reinterpret_cast< void** >( address ) = nullptr;
+				return true;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				return LoadPointee( pointerType.GetInternalTypeDesc().GetType(), reader, context, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				return LoadPointee( pointerType.GetInternalTypeDesc().GetType(), reader, context, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+			case Type::Kind::Array:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& elementType = containerType.GetInternalTypeDesc().GetType();
+				if ( IsFixedSize( elementType ) )
+				{
+					return reader.Read( address, type.GetSize() );
+				}
+
+				const size_t elementsAmount = containerType.GetElementsAmount( address );
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					if ( !LoadValue( address + i * elementType.GetSize(), elementType, reader, context ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+				return LoadDynamicContainer( address, static_cast< const DynamicContainerType& >( type ), reader, context );
+
+			default:
+				return LoadObject( address, type, reader, context );
+			}
+		}
+
+		static bool LoadDynamicContainer( uint8_t* address, const DynamicContainerType& type, internal::BinaryStreamReader& reader, LoadContext& context )
+		{
+			uint64 elementsAmount = 0u;
+			if ( !reader.ReadValue( elementsAmount ) )
+			{
+				return false;
+			}
+
+			type.Clear( address );
+			const Type& elementType = type.GetInternalTypeDesc().GetType();
+			return internal::LoadDynamicContainer( address, type, elementsAmount, GetMinEncodedSize( elementType ), IsFixedSize( elementType ), reader,
+				[ & ]( uint8_t* data, size_t size ) { return reader.Read( data, size ); },
+				[ & ]( uint8_t* element ) { return LoadValue( element, elementType, reader, context ); } );
+		}
+
+		// Lower bound of the amount of bytes taken by a value, elements of containers can't be trusted to take more.
+		static size_t GetMinEncodedSize( const Type& type )
+		{
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::String:
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+				return sizeof( uint64 );
+			case Type::Kind::UniquePointer:
+			case Type::Kind::SharedPointer:
+				return sizeof( ID );
+			default:
+				return IsFixedSize( type ) ? type.GetSize() : 0u;
+			}
+		}
+
+		static bool LoadObject( uint8_t* address, const Type& type, internal::BinaryStreamReader& reader, LoadContext& context )
+		{
+			const RemapPlan*& plan = context.m_remapPlans[ type.GetID() ];
+			if ( !plan )
+			{
+				auto schema = context.m_schemas.find( type.GetID() );
+				if ( schema == context.m_schemas.end() )
+				{
+					return false;
+				}
+
+				plan = &GetRemapPlan( schema->second, type );
+			}
+
+			for ( const RemapPlan::Op& op : plan->m_ops )
+			{
+				switch ( op.m_kind )
+				{
+				case RemapPlan::OpKind::Copy:
+					if ( !reader.Read( address + op.m_offset, op.m_size ) )
+					{
+						return false;
+					}
+					break;
+
+				case RemapPlan::OpKind::Skip:
+					if ( !reader.Skip( op.m_size ) )
+					{
+						return false;
+					}
+					break;
+
+				case RemapPlan::OpKind::Read:
+				case RemapPlan::OpKind::SkipVariable:
+				{
+					uint64 length = 0u;
+					if ( !reader.ReadValue( length ) || length > reader.GetRemainingSize() )
+					{
+						return false;
+					}
+
+					internal::BinaryStreamReader propertyReader( reader.Skip( static_cast< size_t >( length ) ), static_cast< size_t >( length ) );
+					if ( op.m_kind == RemapPlan::OpKind::Read && !LoadValue( address + op.m_offset, *op.m_type, propertyReader, context ) )
+					{
+						return false;
+					}
+					break;
+				}
+
+				case RemapPlan::OpKind::Reset:
+					ResetValue( address + op.m_offset, *op.m_type );
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		template< class TSetter >
+		static bool LoadPointee( const Type& internalType, internal::BinaryStreamReader& reader, LoadContext& context, const TSetter& setter )
+		{
+			ID typeId = 0u;
+			if ( !reader.ReadValue( typeId ) )
+			{
+				return false;
+			}
+
+			if ( typeId == 0u )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			uint64 length = 0u;
+			if ( !reader.ReadValue( length ) || length > reader.GetRemainingSize() )
+			{
+				return false;
+			}
+
+			internal::BinaryStreamReader pointeeReader( reader.Skip( static_cast< size_t >( length ) ), static_cast< size_t >( length ) );
+
+			// Pointees of types which don't exist anymore are dropped.
+			const Type* trueType = internal::FindPointeeType( internalType, typeId );
+			if ( !trueType )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			void* pointee = trueType->Construct();
+			if ( !pointee )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			setter( pointee );
+			return LoadValue( static_cast< uint8_t* >( pointee ), *trueType, pointeeReader, context );
+		}
+	};
+}
+#pragma endregion
+
+#pragma region ObjectBlob
+namespace rtti
+{
+	namespace internal
+	{
+		// Replaces std::string and std::vector inside of blobs. Offset is relative to the record's address.
+		struct BlobRecord
+		{
+			int64 m_offset = 0;
+			uint64 m_count = 0u;
+		};
+
+		static_assert( sizeof( BlobRecord ) <= sizeof( std::string ) && sizeof( BlobRecord ) <= sizeof( std::vector< uint8_t > ), "Blob record has to fit in place of the replaced object" );
+
+		struct BlobHeader
+		{
+			uint32_t m_magic = 0u;
+			uint32_t m_alignment = 0u;
+			ID m_rootTypeId = 0u;
+			uint64 m_layoutHash = 0u;
+			uint64 m_rootOffset = 0u;
+			uint64 m_size = 0u;
+		};
+
+		class BlobRange
+		{
+		public:
+			BlobRange() = default;
+			BlobRange( const uint8_t* begin, const uint8_t* end )
+				: m_begin( begin )
+				, m_end( end )
+			{}
+
+			// Returns address pointed by the record or nullptr if it points outside of the blob.
+			const uint8_t* Resolve( const uint8_t* recordAddress, uint64 elementSize ) const
+			{
+				BlobRecord record;
+				std::memcpy( &record, recordAddress, sizeof( record ) );
+
+				// Validated as integers relative to the blob, pointers outside of it can't be even formed.
+				const int64 recordPosition = static_cast< int64 >( recordAddress - m_begin );
+				const int64 blobSize = static_cast< int64 >( m_end - m_begin );
+				if ( record.m_offset < -recordPosition || record.m_offset > blobSize - recordPosition )
+				{
+					return nullptr;
+				}
+
+				const uint64 position = static_cast< uint64 >( recordPosition + record.m_offset );
+				if ( elementSize > 0u && record.m_count > ( static_cast< uint64 >( blobSize ) - position ) / elementSize )
+				{
+					return nullptr;
+				}
+
+				return m_begin + position;
+			}
+
+		private:
+			const uint8_t* m_begin = nullptr;
+			const uint8_t* m_end = nullptr;
+		};
+	}
+
+	class BlobArrayView;
+
+	// Read-only view of an object stored in a blob.
+	class BlobObjectView
+	{
+	public:
+		BlobObjectView() = default;
+		BlobObjectView( const uint8_t* address, const Type& type, const internal::BlobRange& range )
+			: m_address( address )
+			, m_type( &type )
+			, m_range( range )
+		{}
+
+		bool IsValid() const
+		{
+			return m_address != nullptr;
+		}
+
+		const Type* GetType() const
+		{
+			return m_type;
+		}
+
+		const void* GetAddress() const
+		{
+			return m_address;
+		}
+
+		// Returns nullptr if property doesn't exist, it's type is different than T or it can't be accessed directly.
+		template< class T >
+		const T* GetValue( const char* propertyName ) const
+		{
+			const Property* property = FindProperty( propertyName );
+			if ( !property || property->GetType() != GetTypeInstanceOf< T >() || !internal::TypePlan::Get( property->GetType() ).IsTriviallyCopyable() )
+			{
+				return nullptr;
+			}
+
+			return reinterpret_cast< const T* >( m_address + property->GetOffset() );
+		}
+
+		BlobObjectView GetObject( const char* propertyName ) const
+		{
+			const Property* property = FindProperty( propertyName );
+			if ( !property )
+			{
+				return {};
+			}
+
+			return BlobObjectView( m_address + property->GetOffset(), property->GetType(), m_range );
+		}
+
+		std::string_view GetString( const char* propertyName ) const;
+
+		BlobArrayView GetArray( const char* propertyName ) const;
+
+	private:
+		const Property* FindProperty( const char* propertyName ) const
+		{
+			return IsValid() ? m_type->FindProperty( propertyName ) : nullptr;
+		}
+
+		const uint8_t* m_address = nullptr;
+		const Type* m_type = nullptr;
+		internal::BlobRange m_range;
+	};
+
+	// Read-only view of a fixed size array or vector stored in a blob.
+	class BlobArrayView
+	{
+	public:
+		BlobArrayView() = default;
+		BlobArrayView( const uint8_t* data, size_t size, const Type& elementType, const internal::BlobRange& range )
+			: m_data( data )
+			, m_size( size )
+			, m_elementType( &elementType )
+			, m_range( range )
+		{}
+
+		bool IsValid() const
+		{
+			return m_elementType != nullptr;
+		}
+
+		size_t GetSize() const
+		{
+			return m_size;
+		}
+
+		const Type* GetElementType() const
+		{
+			return m_elementType;
+		}
+
+		// Returns nullptr if T is different than the element type or elements can't be accessed directly.
+		template< class T >
+		const T* GetData() const
+		{
+			if ( !IsValid() || *m_elementType != GetTypeInstanceOf< T >() || !internal::TypePlan::Get( *m_elementType ).IsTriviallyCopyable() )
+			{
+				return nullptr;
+			}
+
+			return reinterpret_cast< const T* >( m_data );
+		}
+
+		BlobObjectView GetObject( size_t index ) const
+		{
+			if ( index >= m_size )
+			{
+				return {};
+			}
+
+			return BlobObjectView( GetElementAddress( index ), *m_elementType, m_range );
+		}
+
+		std::string_view GetString( size_t index ) const
+		{
+			if ( index >= m_size || m_elementType->GetKind() != Type::Kind::String )
+			{
+				return {};
+			}
+
+			return ResolveString( GetElementAddress( index ), m_range );
+		}
+
+		BlobArrayView GetArray( size_t index ) const
+		{
+			if ( index >= m_size )
+			{
+				return {};
+			}
+
+			return ResolveArray( GetElementAddress( index ), *m_elementType, m_range );
+		}
+
+		static std::string_view ResolveString( const uint8_t* address, const internal::BlobRange& range )
+		{
+			internal::BlobRecord record;
+			std::memcpy( &record, address, sizeof( record ) );
+			const uint8_t* data = range.Resolve( address, 1u );
+			return data ? std::string_view( reinterpret_cast< const char* >( data ), static_cast< size_t >( record.m_count ) ) : std::string_view();
+		}
+
+		static BlobArrayView ResolveArray( const uint8_t* address, const Type& type, const internal::BlobRange& range )
+		{
+			if ( type.GetKind() != Type::Kind::Array && type.GetKind() != Type::Kind::Vector )
+			{
+				return {};
+			}
+
+			const Type& elementType = static_cast< const ContainerType& >( type ).GetInternalTypeDesc().GetType();
+			if ( type.GetKind() == Type::Kind::Array )
+			{
+				return BlobArrayView( address, type.GetSize() / elementType.GetSize(), elementType, range );
+			}
+
+			internal::BlobRecord record;
+			std::memcpy( &record, address, sizeof( record ) );
+			const uint8_t* data = range.Resolve( address, elementType.GetSize() );
+			return data ? BlobArrayView( data, static_cast< size_t >( record.m_count ), elementType, range ) : BlobArrayView();
+		}
+
+	private:
+		const uint8_t* GetElementAddress( size_t index ) const
+		{
+			return m_data + index * m_elementType->GetSize();
+		}
+
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0u;
+		const Type* m_elementType = nullptr;
+		internal::BlobRange m_range;
+	};
+
+	inline std::string_view BlobObjectView::GetString( const char* propertyName ) const
+	{
+		const Property* property = FindProperty( propertyName );
+		if ( !property || property->GetType().GetKind() != Type::Kind::String )
+		{
+			return {};
+		}
+
+		return BlobArrayView::ResolveString( m_address + property->GetOffset(), m_range );
+	}
+
+	inline BlobArrayView BlobObjectView::GetArray( const char* propertyName ) const
+	{
+		const Property* property = FindProperty( propertyName );
+		if ( !property )
+		{
+			return {};
+		}
+
+		return BlobArrayView::ResolveArray( m_address + property->GetOffset(), property->GetType(), m_range );
+	}
+
+	// Lays out objects in their native memory layout, so they might be used directly from the loaded (e.g. memory mapped) data.
+	// Strings and vectors are replaced with records pointing to their data. Pointers, sets and maps are not supported.
+	class BlobWriter
+	{
+	public:
+		static constexpr uint32_t c_magic = 0x42545452; // "RTTB"
+		static constexpr size_t c_alignment = 16u;
+
+		// Overwrites outBlob. Returns false if the type can't be stored in a blob.
+		static bool Write( const void* address, const Type& type, std::vector< uint8_t >& outBlob )
+		{
+			outBlob.clear();
+			BlobWriter writer( outBlob );
+			writer.Allocate( sizeof( internal::BlobHeader ), alignof( internal::BlobHeader ) );
+			const size_t rootOffset = writer.Allocate( type.GetSize(), type.GetAlignment() );
+			if ( type.GetAlignment() > c_alignment || !writer.WriteWithPlan( static_cast< const uint8_t* >( address ), internal::TypePlan::Get( type ), rootOffset ) )
+			{
+				outBlob.clear();
+				return false;
+			}
+
+			internal::BlobHeader header;
+			header.m_magic = c_magic;
+			header.m_alignment = static_cast< uint32_t >( c_alignment );
+			header.m_rootTypeId = type.GetID();
+			header.m_layoutHash = type.GetLayoutHash();
+			header.m_rootOffset = rootOffset;
+			header.m_size = outBlob.size();
+			std::memcpy( outBlob.data(), &header, sizeof( header ) );
+			return true;
+		}
+
+		template< class T >
+		static bool Write( const T& object, std::vector< uint8_t >& outBlob )
+		{
+			return Write( &object, GetTypeInstanceOf< T >(), outBlob );
+		}
+
+	private:
+		BlobWriter( std::vector< uint8_t >& buffer )
+			: m_buffer( buffer )
+		{}
+
+		size_t Allocate( size_t size, size_t alignment )
+		{
+			const size_t offset = ( m_buffer.size() + alignment - 1u ) / alignment * alignment;
+			m_buffer.resize( offset + size );
+			return offset;
+		}
+
+		void WriteRecord( size_t recordOffset, size_t dataOffset, size_t count )
+		{
+			internal::BlobRecord record;
+			record.m_offset = static_cast< int64 >( dataOffset ) - static_cast< int64 >( recordOffset );
+			record.m_count = count;
+			std::memcpy( m_buffer.data() + recordOffset, &record, sizeof( record ) );
+		}
+
+		// Buffer might be reallocated during writing so destination is always passed as an offset.
+		bool WriteWithPlan( const uint8_t* address, const internal::TypePlan& plan, size_t offset )
+		{
+			using OpKind = internal::TypePlan::OpKind;
+			for ( const internal::TypePlan::Op& op : plan.GetOps() )
+			{
+				const uint8_t* source = address + op.m_offset;
+				const size_t destination = offset + op.m_offset;
+				switch ( op.m_kind )
+				{
+				case OpKind::Copy:
+					std::memcpy( m_buffer.data() + destination, source, op.m_size );
+					break;
+
+				case OpKind::String:
+				{
+					const std::string& str = *reinterpret_cast< const std::string* >( source );
+					const size_t dataOffset = Allocate( str.size() + 1u, 1u );
+					std::memcpy( m_buffer.data() + dataOffset, str.c_str(), str.size() + 1u );
+					WriteRecord( destination, dataOffset, str.size() );
+					break;
+				}
+
+				case OpKind::Container:
+				{
+					if ( !WriteContainer( source, static_cast< const ContainerType& >( *op.m_type ), *op.m_internalPlan, destination ) )
+					{
+						return false;
+					}
+					break;
+				}
+
+				default:
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool WriteContainer( const uint8_t* address, const ContainerType& type, const internal::TypePlan& elementPlan, size_t offset )
+		{
+			const Type& elementType = elementPlan.GetType();
+			const size_t elementSize = elementType.GetSize();
+			const uint8_t* data = static_cast< const uint8_t* >( type.GetData( address ) );
+			if ( !data || ( type.GetKind() != Type::Kind::Array && type.GetKind() != Type::Kind::Vector ) || elementType.GetAlignment() > c_alignment )
+			{
+				return false;
+			}
+
+			const size_t elementsAmount = type.GetElementsAmount( address );
+			size_t dataOffset = offset;
+			if ( type.GetKind() == Type::Kind::Vector )
+			{
+				dataOffset = Allocate( elementsAmount * elementSize, elementType.GetAlignment() );
+				WriteRecord( offset, dataOffset, elementsAmount );
+			}
+
+			if ( elementPlan.IsTriviallyCopyable() )
+			{
+				std::memcpy( m_buffer.data() + dataOffset, data, elementsAmount * elementSize );
+				return true;
+			}
+
+			for ( size_t i = 0u; i < elementsAmount; ++i )
+			{
+				if ( !WriteWithPlan( data + i * elementSize, elementPlan, dataOffset + i * elementSize ) )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		std::vector< uint8_t >& m_buffer;
+	};
+
+	// Validates blob's header against the live type and provides views of the stored objects.
+	// Data has to stay alive and unchanged for as long as the reader and its views are used.
+	class BlobReader
+	{
+	public:
+		BlobReader( const void* data, size_t size, const Type& type )
+		{
+			const uint8_t* bytes = static_cast< const uint8_t* >( data );
+			internal::BlobHeader header;
+			if ( !bytes || size < sizeof( header ) || reinterpret_cast< uintptr_t >( bytes ) % BlobWriter::c_alignment != 0u )
+			{
+				return;
+			}
+
+			std::memcpy( &header, bytes, sizeof( header ) );
+			if ( header.m_magic != BlobWriter::c_magic
+				|| header.m_alignment != BlobWriter::c_alignment
+				|| header.m_rootTypeId != type.GetID()
+				|| header.m_layoutHash != type.GetLayoutHash()
+				|| header.m_size > size
+				|| header.m_rootOffset > header.m_size
+				|| type.GetSize() > header.m_size - header.m_rootOffset )
+			{
+				return;
+			}
+
+			m_root = BlobObjectView( bytes + header.m_rootOffset, type, internal::BlobRange( bytes, bytes + header.m_size ) );
+		}
+
+		template< class T >
+		static BlobReader Create( const void* data, size_t size )
+		{
+			return BlobReader( data, size, GetTypeInstanceOf< T >() );
+		}
+
+		bool IsValid() const
+		{
+			return m_root.IsValid();
+		}
+
+		BlobObjectView GetRoot() const
+		{
+			return m_root;
+		}
+
+		// Returns nullptr if the root can't be accessed directly as T.
+		template< class T >
+		const T* GetRootAs() const
+		{
+			if ( !IsValid() || *m_root.GetType() != GetTypeInstanceOf< T >() || !std::is_trivially_copyable_v< T > || !internal::TypePlan::Get( *m_root.GetType() ).IsTriviallyCopyable() )
+			{
+				return nullptr;
+			}
+
+			return static_cast< const T* >( m_root.GetAddress() );
+		}
+
+	private:
+		BlobObjectView m_root;
+	};
+}
+#pragma endregion
+
+#pragma region JsonSerializer
+namespace rtti
+{
+	namespace internal
+	{
+		class JsonReader
+		{
+		public:
+			JsonReader( std::string_view json )
+				: m_current( json.data() )
+				, m_end( json.data() + json.size() )
+			{}
+
+			void SkipWhitespace()
+			{
+				while ( m_current < m_end && ( *m_current == ' ' || *m_current == '\n' || *m_current == '\r' || *m_current == '\t' ) )
+				{
+					++m_current;
+				}
+			}
+
+			bool Peek( char c )
+			{
+				SkipWhitespace();
+				return m_current < m_end && *m_current == c;
+			}
+
+			bool Consume( char c )
+			{
+				if ( Peek( c ) )
+				{
+					++m_current;
+					return true;
+				}
+
+				return false;
+			}
+
+			bool ConsumeLiteral( std::string_view literal )
+			{
+				SkipWhitespace();
+				if ( static_cast< size_t >( m_end - m_current ) >= literal.size() && std::string_view( m_current, literal.size() ) == literal )
+				{
+					m_current += literal.size();
+					return true;
+				}
+
+				return false;
+			}
+
+			bool IsAtEnd()
+			{
+				SkipWhitespace();
+				return m_current == m_end;
+			}
+
+			// Returns view of the input if the string has no escape sequences, otherwise decodes it into the storage.
+			bool ReadString( std::string_view& outString, std::string& storage )
+			{
+				if ( !Consume( '"' ) )
+				{
+					return false;
+				}
+
+				const char* begin = m_current;
+				while ( m_current < m_end && *m_current != '"' && *m_current != '\\' )
+				{
+					++m_current;
+				}
+
+				if ( m_current == m_end )
+				{
+					return false;
+				}
+
+				if ( *m_current == '"' )
+				{
+					outString = std::string_view( begin, m_current - begin );
+					++m_current;
+					return true;
+				}
+
+				storage.assign( begin, m_current );
+				if ( !ReadEscapedString( storage ) )
+				{
+					return false;
+				}
+
+				outString = storage;
+				return true;
+			}
+
+			bool ReadNumber( std::string_view& outNumber )
+			{
+				SkipWhitespace();
+				const char* begin = m_current;
+				while ( m_current < m_end && ( ( *m_current >= '0' && *m_current <= '9' ) || *m_current == '-' || *m_current == '+' || *m_current == '.' || *m_current == 'e' || *m_current == 'E' ) )
+				{
+					++m_current;
+				}
+
+				outNumber = std::string_view( begin, m_current - begin );
+				return !outNumber.empty();
+			}
+
+			bool SkipValue( uint32_t depth )
+			{
+				if ( depth > c_maxDepth )
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if ( m_current == m_end )
+				{
+					return false;
+				}
+
+				switch ( *m_current )
+				{
+				case '"':
+				{
+					std::string_view str;
+					std::string storage;
+					return ReadString( str, storage );
+				}
+
+				case '{':
+				case '[':
+				{
+					const bool isObject = *m_current == '{';
+					const char closing = isObject ? '}' : ']';
+					++m_current;
+					if ( Consume( closing ) )
+					{
+						return true;
+					}
+
+					do
+					{
+						if ( isObject && ( !SkipValue( depth + 1u ) || !Consume( ':' ) ) )
+						{
+							return false;
+						}
+
+						if ( !SkipValue( depth + 1u ) )
+						{
+							return false;
+						}
+					} while ( Consume( ',' ) );
+
+					return Consume( closing );
+				}
+
+				case 't':
+					return ConsumeLiteral( "true" );
+
+				case 'f':
+					return ConsumeLiteral( "false" );
+
+				case 'n':
+					return ConsumeLiteral( "null" );
+
+				default:
+				{
+					std::string_view number;
+					return ReadNumber( number );
+				}
+				}
+			}
+
+			static constexpr uint32_t c_maxDepth = 512u;
+
+		private:
+			bool ReadEscapedString( std::string& outString )
+			{
+				while ( m_current < m_end )
+				{
+					const char c = *m_current++;
+					if ( c == '"' )
+					{
+						return true;
+					}
+
+					if ( c != '\\' )
+					{
+						outString += c;
+						continue;
+					}
+
+					if ( m_current == m_end )
+					{
+						return false;
+					}
+
+					switch ( *m_current++ )
+					{
+					case '"': outString += '"'; break;
+					case '\\': outString += '\\'; break;
+					case '/': outString += '/'; break;
+					case 'b': outString += '\b'; break;
+					case 'f': outString += '\f'; break;
+					case 'n': outString += '\n'; break;
+					case 'r': outString += '\r'; break;
+					case 't': outString += '\t'; break;
+					case 'u':
+					{
+						uint32_t codePoint = 0u;
+						if ( !ReadHex( codePoint ) )
+						{
+							return false;
+						}
+
+						if ( codePoint >= 0xD800u && codePoint <= 0xDBFFu )
+						{
+							uint32_t lowSurrogate = 0u;
+							if ( !ConsumeLiteral( "\\u" ) || !ReadHex( lowSurrogate ) || lowSurrogate < 0xDC00u || lowSurrogate > 0xDFFFu )
+							{
+								return false;
+							}
+
+							codePoint = 0x10000u + ( ( codePoint - 0xD800u ) << 10u ) + ( lowSurrogate - 0xDC00u );
+						}
+
+						AppendUtf8( codePoint, outString );
+						break;
+					}
+					default:
+						return false;
+					}
+				}
+
+				return false;
+			}
+
+			bool ReadHex( uint32_t& outValue )
+			{
+				if ( m_end - m_current < 4 )
+				{
+					return false;
+				}
+
+				const auto result = std::from_chars( m_current, m_current + 4, outValue, 16 );
+				if ( result.ptr != m_current + 4 )
+				{
+					return false;
+				}
+
+				m_current += 4;
+				return true;
+			}
+
+			static void AppendUtf8( uint32_t codePoint, std::string& outString )
+			{
+				if ( codePoint < 0x80u )
+				{
+					outString += static_cast< char >( codePoint );
+				}
+				else if ( codePoint < 0x800u )
+				{
+					outString += static_cast< char >( 0xC0u | ( codePoint >> 6u ) );
+					outString += static_cast< char >( 0x80u | ( codePoint & 0x3Fu ) );
+				}
+				else if ( codePoint < 0x10000u )
+				{
+					outString += static_cast< char >( 0xE0u | ( codePoint >> 12u ) );
+					outString += static_cast< char >( 0x80u | ( ( codePoint >> 6u ) & 0x3Fu ) );
+					outString += static_cast< char >( 0x80u | ( codePoint & 0x3Fu ) );
+				}
+				else
+				{
+					outString += static_cast< char >( 0xF0u | ( codePoint >> 18u ) );
+					outString += static_cast< char >( 0x80u | ( ( codePoint >> 12u ) & 0x3Fu ) );
+					outString += static_cast< char >( 0x80u | ( ( codePoint >> 6u ) & 0x3Fu ) );
+					outString += static_cast< char >( 0x80u | ( codePoint & 0x3Fu ) );
+				}
+			}
+
+			const char* m_current = nullptr;
+			const char* m_end = nullptr;
+		};
+
+		enum class NumberKind : uint8_t
+		{
+			Unknown,
+			Bool,
+			Int8,
+			Int32,
+			Int64,
+			Uint16,
+			Uint32,
+			Uint64,
+			Float,
+			Double
+		};
+
+		inline NumberKind GetNumberKind( const Type& type )
+		{
+			static const std::unordered_map< ID, NumberKind > s_kinds =
+			{
+				{ GetTypeInstanceOf< bool >().GetID(), NumberKind::Bool },
+				{ GetTypeInstanceOf< __int8 >().GetID(), NumberKind::Int8 },
+				{ GetTypeInstanceOf< __int32 >().GetID(), NumberKind::Int32 },
+				{ GetTypeInstanceOf< __int64 >().GetID(), NumberKind::Int64 },
+				{ GetTypeInstanceOf< unsigned short >().GetID(), NumberKind::Uint16 },
+				{ GetTypeInstanceOf< unsigned >().GetID(), NumberKind::Uint32 },
+				{ GetTypeInstanceOf< unsigned long long >().GetID(), NumberKind::Uint64 },
+				{ GetTypeInstanceOf< float >().GetID(), NumberKind::Float },
+				{ GetTypeInstanceOf< double >().GetID(), NumberKind::Double }
+			};
+
+			auto found = s_kinds.find( type.GetID() );
+			return found != s_kinds.end() ? found->second : NumberKind::Unknown;
+		}
+	}
+
+	// Writes and reads JSON directly from and to objects, without any intermediate document.
+	// Enums are stored by their members' names, maps as arrays of { "First", "Second" } objects
+	// and pointees which type differs from the pointer's type start with a "$type" key.
+	class JsonSerializer
+	{
+	public:
+		static void Save( const void* address, const Type& type, std::string& outJson )
+		{
+			SaveContext context{ outJson };
+			SaveValue( static_cast< const uint8_t* >( address ), type, context );
+		}
+
+		template< class T >
+		static void Save( const T& object, std::string& outJson )
+		{
+			Save( &object, GetTypeInstanceOf< T >(), outJson );
+		}
+
+		static bool Load( void* address, const Type& type, std::string_view json )
+		{
+			internal::JsonReader reader( json );
+			LoadContext context;
+			return LoadValue( static_cast< uint8_t* >( address ), type, reader, context, 0u ) && reader.IsAtEnd();
+		}
+
+		template< class T >
+		static bool Load( T& object, std::string_view json )
+		{
+			return Load( &object, GetTypeInstanceOf< T >(), json );
+		}
+
+	private:
+		static constexpr std::string_view c_typeKey = "$type";
+
+		// Precomputed keys for writing and key hash dispatch for reading.
+		struct ObjectInfo
+		{
+			struct Member
+			{
+				std::string m_key;
+				const Property* m_property = nullptr;
+			};
+
+			std::vector< Member > m_members;
+			std::unordered_map< ID, const Property* > m_properties;
+		};
+
+		// Infos used by a single Save or Load. Properties of runtime types might change between calls, so their infos live only here.
+		struct ObjectInfos
+		{
+			std::unordered_map< ID, const ObjectInfo* > m_infos;
+			std::vector< std::unique_ptr< ObjectInfo > > m_runtimeTypeInfos;
+		};
+
+		struct SaveContext
+		{
+			std::string& m_json;
+			ObjectInfos m_objectInfos;
+
+			// Scratch buffer for names of flags enums.
+			std::string m_flagNames;
+		};
+
+		struct LoadContext
+		{
+			std::string m_stringStorage;
+			ObjectInfos m_objectInfos;
+		};
+
+		static bool IsClassLike( const Type& type )
+		{
+			const Type::Kind kind = type.GetKind();
+			return kind == Type::Kind::Class || kind == Type::Kind::Struct || kind == Type::Kind::RuntimeType;
+		}
+
+		static const ObjectInfo& GetObjectInfo( const Type& type, ObjectInfos& localInfos )
+		{
+			const ObjectInfo*& localInfo = localInfos.m_infos[ type.GetID() ];
+			if ( localInfo )
+			{
+				return *localInfo;
+			}
+
+			if ( type.GetKind() == Type::Kind::RuntimeType )
+			{
+				localInfo = localInfos.m_runtimeTypeInfos.emplace_back( CreateObjectInfo( type ) ).get();
+				return *localInfo;
+			}
+
+			static std::mutex s_mutex;
+			static std::unordered_map< ID, std::unique_ptr< ObjectInfo > > s_infos;
+
+			std::lock_guard< std::mutex > lock( s_mutex );
+			std::unique_ptr< ObjectInfo >& info = s_infos[ type.GetID() ];
+			if ( !info )
+			{
+				info = CreateObjectInfo( type );
+			}
+
+			localInfo = info.get();
+			return *info;
+		}
+
+		static std::unique_ptr< ObjectInfo > CreateObjectInfo( const Type& type )
+		{
+			auto info = std::make_unique< ObjectInfo >();
+			for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+			{
+				const Property* property = type.GetProperty( i );
+				std::string key;
+				AppendString( property->GetName(), key );
+				key += ':';
+				info->m_members.push_back( { std::move( key ), property } );
+				info->m_properties.emplace( property->GetID(), property );
+			}
+
+			return info;
+		}
+
+		static void AppendString( std::string_view str, std::string& json )
+		{
+			json += '"';
+			size_t runBegin = 0u;
+			for ( size_t i = 0u; i < str.size(); ++i )
+			{
+				const unsigned char c = static_cast< unsigned char >( str[ i ] );
+				if ( c >= 0x20u && c != '"' && c != '\\' )
+				{
+					continue;
+				}
+
+				json.append( str.data() + runBegin, i - runBegin );
+				runBegin = i + 1u;
+				switch ( c )
+				{
+				case '"': json += "\\\""; break;
+				case '\\': json += "\\\\"; break;
+				case '\b': json += "\\b"; break;
+				case '\f': json += "\\f"; break;
+				case '\n': json += "\\n"; break;
+				case '\r': json += "\\r"; break;
+				case '\t': json += "\\t"; break;
+				default:
+				{
+					constexpr const char* hexDigits = "0123456789abcdef";
+					json += "\\u00";
+					json += hexDigits[ c >> 4u ];
+					json += hexDigits[ c & 0xFu ];
+					break;
+				}
+				}
+			}
+
+			json.append( str.data() + runBegin, str.size() - runBegin );
+			json += '"';
+		}
+
+		template< class T >
+		static void AppendNumber( T value, std::string& json )
+		{
+			if constexpr ( std::is_floating_point_v< T > )
+			{
+				if ( value != value || value - value != 0 )
+				{
+					json += "null"; // NaN and infinity are not representable in JSON
+					return;
+				}
+			}
+
+			char buffer[ 32 ];
+			const auto result = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+			json.append( buffer, result.ptr );
+		}
+
+		static void SaveNumber( const uint8_t* address, const Type& type, std::string& json )
+		{
+			switch ( internal::GetNumberKind( type ) )
+			{
+			case internal::NumberKind::Bool: json += *reinterpret_cast< const bool* >( address ) ? "true" : "false"; break;
+			case internal::NumberKind::Int8: AppendNumber( static_cast< int >( *reinterpret_cast< const __int8* >( address ) ), json ); break;
+			case internal::NumberKind::Int32: AppendNumber( *reinterpret_cast< const __int32* >( address ), json ); break;
+			case internal::NumberKind::Int64: AppendNumber( *reinterpret_cast< const __int64* >( address ), json ); break;
+			case internal::NumberKind::Uint16: AppendNumber( *reinterpret_cast< const unsigned short* >( address ), json ); break;
+			case internal::NumberKind::Uint32: AppendNumber( *reinterpret_cast< const unsigned* >( address ), json ); break;
+			case internal::NumberKind::Uint64: AppendNumber( *reinterpret_cast< const unsigned long long* >( address ), json ); break;
+			case internal::NumberKind::Float: AppendNumber( *reinterpret_cast< const float* >( address ), json ); break;
+			case internal::NumberKind::Double: AppendNumber( *reinterpret_cast< const double* >( address ), json ); break;
+			default: json += "null"; break;
+			}
+		}
+
+		static void SaveValue( const uint8_t* address, const Type& type, SaveContext& context )
+		{
+			std::string& json = context.m_json;
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+				SaveNumber( address, type, json );
+				break;
+
+			case Type::Kind::Enum:
+			{
+				const auto& enumType = static_cast< const EnumTypeBase& >( type );
+				std::string& flagNames = context.m_flagNames;
+				flagNames.clear();
+				if ( const EnumTypeBase::MemberDesc* member = enumType.GetCurrentMember( address ) )
+				{
+					AppendString( member->m_name, json );
+				}
+				else if ( enumType.IsFlags() && enumType.AppendFlagNames( enumType.GetCurrentValue( address ), flagNames ) )
+				{
+					AppendString( flagNames, json );
+				}
+				else
+				{
+					AppendNumber( static_cast< int64 >( enumType.GetCurrentValue( address ) ), json );
+				}
+				break;
+			}
+
+			case Type::Kind::String:
+				AppendString( *reinterpret_cast< const std::string* >( address ), json );
+				break;
+
+			case Type::Kind::RawPointer:
+				json += "null";
+				break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), context );
+				break;
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), context );
+				break;
+			}
+#endif
+
+			case Type::Kind::Array:
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& elementType = containerType.GetInternalTypeDesc().GetType();
+				json += '[';
+				bool isFirst = true;
+				containerType.VisitElements( address, [ & ]( const void* element )
+					{
+						if ( !isFirst )
+						{
+							json += ',';
+						}
+
+						isFirst = false;
+						SaveValue( static_cast< const uint8_t* >( element ), elementType, context );
+						return VisitOutcome::Continue;
+					} );
+				json += ']';
+				break;
+			}
+
+			default:
+				json += '{';
+				SaveMembers( address, type, context, true );
+				json += '}';
+				break;
+			}
+		}
+
+		static void SaveMembers( const uint8_t* address, const Type& type, SaveContext& context, bool isFirst )
+		{
+			for ( const ObjectInfo::Member& member : GetObjectInfo( type, context.m_objectInfos ).m_members )
+			{
+				if ( !isFirst )
+				{
+					context.m_json += ',';
+				}
+
+				isFirst = false;
+				context.m_json += member.m_key;
+				SaveValue( address + member.m_property->GetOffset(), member.m_property->GetType(), context );
+			}
+		}
+
+		static void SavePointee( const void* pointee, const Type& internalType, SaveContext& context )
+		{
+			if ( !pointee )
+			{
+				context.m_json += "null";
+				return;
+			}
+
+			const Type& trueType = internalType.GetTrueType( pointee );
+			if ( trueType == internalType )
+			{
+				SaveValue( static_cast< const uint8_t* >( pointee ), trueType, context );
+				return;
+			}
+
+			context.m_json += '{';
+			AppendString( c_typeKey, context.m_json );
+			context.m_json += ':';
+			AppendString( trueType.GetName(), context.m_json );
+			SaveMembers( static_cast< const uint8_t* >( pointee ), trueType, context, false );
+			context.m_json += '}';
+		}
+
+		template< class T >
+		static bool ParseNumber( std::string_view token, uint8_t* address )
+		{
+			T value{};
+			const auto result = std::from_chars( token.data(), token.data() + token.size(), value );
+			if ( result.ec != std::errc() || result.ptr != token.data() + token.size() )
+			{
+				return false;
+			}
+
+			std::memcpy( address, &value, sizeof( T ) );
+			return true;
+		}
+
+		static bool LoadNumber( uint8_t* address, const Type& type, internal::JsonReader& reader )
+		{
+			const internal::NumberKind kind = internal::GetNumberKind( type );
+			if ( kind == internal::NumberKind::Bool )
+			{
+				if ( reader.ConsumeLiteral( "true" ) )
+				{
+					*reinterpret_cast< bool* >( address ) = true;
+					return true;
+				}
+
+				if ( reader.ConsumeLiteral( "false" ) )
+				{
+					*reinterpret_cast< bool* >( address ) = false;
+					return true;
+				}
+
+				return false;
+			}
+
+			if ( reader.ConsumeLiteral( "null" ) )
+			{
+				return kind == internal::NumberKind::Float || kind == internal::NumberKind::Double;
+			}
+
+			std::string_view token;
+			if ( !reader.ReadNumber( token ) )
+			{
+				return false;
+			}
+
+			switch ( kind )
+			{
+			case internal::NumberKind::Int8:
+			{
+				int value = 0;
+				if ( !ParseNumber< int >( token, reinterpret_cast< uint8_t* >( &value ) ) || value < -128 || value > 127 )
+				{
+					return false;
+				}
+
+				*reinterpret_cast< __int8* >( address ) = static_cast< __int8 >( value );
+				return true;
+			}
+			case internal::NumberKind::Int32: return ParseNumber< __int32 >( token, address );
+			case internal::NumberKind::Int64: return ParseNumber< __int64 >( token, address );
+			case internal::NumberKind::Uint16: return ParseNumber< unsigned short >( token, address );
+			case internal::NumberKind::Uint32: return ParseNumber< unsigned >( token, address );
+			case internal::NumberKind::Uint64: return ParseNumber< unsigned long long >( token, address );
+			case internal::NumberKind::Float: return ParseNumber< float >( token, address );
+			case internal::NumberKind::Double: return ParseNumber< double >( token, address );
+			default: return false;
+			}
+		}
+
+		static bool LoadValue( uint8_t* address, const Type& type, internal::JsonReader& reader, LoadContext& context, uint32_t depth )
+		{
+			if ( depth > internal::JsonReader::c_maxDepth )
+			{
+				return false;
+			}
+
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+				return LoadNumber( address, type, reader );
+
+			case Type::Kind::Enum:
+			{
+				const auto& enumType = static_cast< const EnumTypeBase& >( type );
+				std::string_view name;
+				if ( reader.Peek( '"' ) )
+				{
+					if ( !reader.ReadString( name, context.m_stringStorage ) )
+					{
+						return false;
+					}
+
+					EnumTypeBase::MemberDesc member;
+					if ( const EnumTypeBase::MemberDesc* foundMember = enumType.FindMember( name ) )
+					{
+						member = *foundMember;
+					}
+					else if ( !enumType.IsFlags() || !enumType.ParseFlagNames( name, member.m_value ) )
+					{
+						return false;
+					}
+
+					enumType.SetCurrentMember( address, member );
+					return true;
+				}
+
+				std::string_view token;
+				uint8_t value[ sizeof( int64 ) ];
+				if ( !reader.ReadNumber( token ) || !ParseNumber< int64 >( token, value ) )
+				{
+					return false;
+				}
+
+				EnumTypeBase::MemberDesc member;
+				std::memcpy( &member.m_value, value, sizeof( value ) );
+				enumType.SetCurrentMember( address, member );
+				return true;
+			}
+
+			case Type::Kind::String:
+			{
+				std::string_view str;
+				if ( !reader.ReadString( str, context.m_stringStorage ) )
+				{
+					return false;
+				}
+
+				reinterpret_cast< std::string* >( address )->assign( str );
+				return true;
+			}
+
+			case Type::Kind::RawPointer:
+				*reinterpret_cast< void** >( address ) = nullptr;
+				return reader.SkipValue( depth );
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				return LoadPointee( pointerType.GetInternalTypeDesc().GetType(), reader, context, depth, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				return LoadPointee( pointerType.GetInternalTypeDesc().GetType(), reader, context, depth, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+			case Type::Kind::Array:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& elementType = containerType.GetInternalTypeDesc().GetType();
+				const size_t elementsAmount = containerType.GetElementsAmount( address );
+				if ( !reader.Consume( '[' ) )
+				{
+					return false;
+				}
+
+				if ( reader.Consume( ']' ) )
+				{
+					return true;
+				}
+
+				size_t index = 0u;
+				do
+				{
+					if ( index == elementsAmount || !LoadValue( address + index * elementType.GetSize(), elementType, reader, context, depth + 1u ) )
+					{
+						return false;
+					}
+
+					++index;
+				} while ( reader.Consume( ',' ) );
+
+				return reader.Consume( ']' );
+			}
+
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+				return LoadDynamicContainer( address, static_cast< const DynamicContainerType& >( type ), reader, context, depth );
+
+			default:
+				return reader.Consume( '{' ) && LoadMembers( address, type, reader, context, depth, {} );
+			}
+		}
+
+		static bool LoadDynamicContainer( uint8_t* address, const DynamicContainerType& type, internal::JsonReader& reader, LoadContext& context, uint32_t depth )
+		{
+			if ( !reader.Consume( '[' ) )
+			{
+				return false;
+			}
+
+			type.Clear( address );
+			if ( reader.Consume( ']' ) )
+			{
+				return true;
+			}
+
+			// Elements of contiguous containers are loaded in place, other containers need a temporary element.
+			const Type& elementType = type.GetInternalTypeDesc().GetType();
+			type.AddDefaultElement( address );
+			const bool isContiguous = type.GetData( address ) != nullptr;
+			std::unique_ptr< internal::ElementBuffer > element;
+			if ( !isContiguous )
+			{
+				type.Clear( address );
+				element = std::make_unique< internal::ElementBuffer >( elementType );
+			}
+
+			size_t index = 0u;
+			do
+			{
+				if ( isContiguous )
+				{
+					if ( index > 0u )
+					{
+						type.AddDefaultElement( address );
+					}
+
+					if ( !LoadValue( static_cast< uint8_t* >( type.GetData( address ) ) + index * elementType.GetSize(), elementType, reader, context, depth + 1u ) )
+					{
+						return false;
+					}
+
+					++index;
+					continue;
+				}
+
+				elementType.ConstructInPlace( element->Get() );
+				const bool result = LoadValue( static_cast< uint8_t* >( element->Get() ), elementType, reader, context, depth + 1u );
+				if ( result )
+				{
+					type.EmplaceElement( address, element->Get() );
+				}
+
+				elementType.Destroy( element->Get() );
+				if ( !result )
+				{
+					return false;
+				}
+			} while ( reader.Consume( ',' ) );
+
+			return reader.Consume( ']' );
+		}
+
+		// Expects object's opening brace to be already consumed. Skips members if address is nullptr.
+		static bool LoadMembers( uint8_t* address, const Type& type, internal::JsonReader& reader, LoadContext& context, uint32_t depth, std::string_view pendingKey )
+		{
+			if ( pendingKey.empty() && reader.Consume( '}' ) )
+			{
+				return true;
+			}
+
+			const ObjectInfo* info = address ? &GetObjectInfo( type, context.m_objectInfos ) : nullptr;
+			std::string_view key = pendingKey;
+			std::string keyStorage;
+			while ( true )
+			{
+				if ( key.empty() && !reader.ReadString( key, keyStorage ) )
+				{
+					return false;
+				}
+
+				if ( !reader.Consume( ':' ) )
+				{
+					return false;
+				}
+
+				const Property* property = nullptr;
+				if ( info )
+				{
+					auto found = info->m_properties.find( internal::CalcHash( key ) );
+					property = found != info->m_properties.end() && key == found->second->GetName() ? found->second : nullptr;
+				}
+
+				// Unknown keys are skipped to keep older files loadable.
+				const bool result = property ? LoadValue( address + property->GetOffset(), property->GetType(), reader, context, depth + 1u ) : reader.SkipValue( depth + 1u );
+				if ( !result )
+				{
+					return false;
+				}
+
+				if ( !reader.Consume( ',' ) )
+				{
+					return reader.Consume( '}' );
+				}
+
+				key = {};
+			}
+		}
+
+		template< class TSetter >
+		static bool LoadPointee( const Type& internalType, internal::JsonReader& reader, LoadContext& context, uint32_t depth, const TSetter& setter )
+		{
+			if ( reader.ConsumeLiteral( "null" ) )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			const Type* trueType = &internalType;
+			std::string_view pendingKey;
+			std::string keyStorage;
+			if ( IsClassLike( internalType ) )
+			{
+				if ( !reader.Consume( '{' ) )
+				{
+					return false;
+				}
+
+				if ( !reader.Peek( '}' ) )
+				{
+					if ( !reader.ReadString( pendingKey, keyStorage ) )
+					{
+						return false;
+					}
+
+					if ( pendingKey == c_typeKey )
+					{
+						std::string_view typeName;
+						if ( !reader.Consume( ':' ) || !reader.ReadString( typeName, context.m_stringStorage ) )
+						{
+							return false;
+						}
+
+						trueType = ::rtti::Get().FindType( std::string( typeName ).c_str() );
+						if ( trueType && *trueType != internalType && !trueType->InheritsFrom( internalType ) )
+						{
+							trueType = nullptr;
+						}
+
+						pendingKey = {};
+						if ( !reader.Consume( ',' ) )
+						{
+							if ( !reader.Peek( '}' ) )
+							{
+								return false;
+							}
+						}
+					}
+				}
+			}
+
+			void* pointee = trueType ? trueType->Construct() : nullptr;
+			setter( pointee );
+			if ( !IsClassLike( internalType ) )
+			{
+				return pointee && LoadValue( static_cast< uint8_t* >( pointee ), *trueType, reader, context, depth + 1u );
+			}
+
+			// Pointees of unknown types are dropped.
+			return LoadMembers( static_cast< uint8_t* >( pointee ), trueType ? *trueType : internalType, reader, context, depth + 1u, pendingKey );
+		}
+	};
+}
+#pragma endregion
+
+#pragma region MessagePackSerializer
+namespace rtti
+{
+	// Compact MessagePack encoding. Objects are maps keyed by property IDs (or indices), enums are stored as their underlying integers
+	// and contiguous containers of primitives as bin payloads in the native byte order. Pointers are either nil or [ true type ID, value ].
+	class MessagePackSerializer
+	{
+	public:
+		enum class KeyMode : uint8_t
+		{
+			PropertyId,
+			Index
+		};
+
+		static void Save( const void* address, const Type& type, std::vector< uint8_t >& outBuffer, KeyMode keyMode = KeyMode::PropertyId )
+		{
+			internal::BinaryStreamWriter writer( outBuffer );
+			SaveValue( static_cast< const uint8_t* >( address ), type, writer, keyMode );
+		}
+
+		template< class T >
+		static void Save( const T& object, std::vector< uint8_t >& outBuffer, KeyMode keyMode = KeyMode::PropertyId )
+		{
+			Save( &object, GetTypeInstanceOf< T >(), outBuffer, keyMode );
+		}
+
+		static bool Load( void* address, const Type& type, const uint8_t* data, size_t size, KeyMode keyMode = KeyMode::PropertyId )
+		{
+			internal::BinaryStreamReader reader( data, size );
+			LoadContext context{ keyMode };
+			return LoadValue( static_cast< uint8_t* >( address ), type, reader, context, 0u );
+		}
+
+		template< class T >
+		static bool Load( T& object, const std::vector< uint8_t >& buffer, KeyMode keyMode = KeyMode::PropertyId )
+		{
+			return Load( &object, GetTypeInstanceOf< T >(), buffer.data(), buffer.size(), keyMode );
+		}
+
+	private:
+		static constexpr uint32_t c_maxDepth = 512u;
+
+		struct LoadContext
+		{
+			KeyMode m_keyMode = KeyMode::PropertyId;
+			std::unordered_map< ID, const std::unordered_map< ID, const Property* >* > m_properties;
+
+			// Properties of runtime types might change between calls, so their maps live only during a single Load.
+			std::vector< std::unique_ptr< std::unordered_map< ID, const Property* > > > m_runtimeTypeProperties;
+		};
+
+		static bool IsBinaryPayload( const Type& elementType )
+		{
+			return elementType.GetKind() == Type::Kind::Primitive || elementType.GetKind() == Type::Kind::Enum;
+		}
+
+		static const std::unordered_map< ID, const Property* >& GetPropertiesById( const Type& type, LoadContext& context )
+		{
+			const std::unordered_map< ID, const Property* >*& localProperties = context.m_properties[ type.GetID() ];
+			if ( localProperties )
+			{
+				return *localProperties;
+			}
+
+			if ( type.GetKind() == Type::Kind::RuntimeType )
+			{
+				localProperties = context.m_runtimeTypeProperties.emplace_back( CreatePropertiesById( type ) ).get();
+				return *localProperties;
+			}
+
+			static std::mutex s_mutex;
+			static std::unordered_map< ID, std::unique_ptr< std::unordered_map< ID, const Property* > > > s_properties;
+
+			std::lock_guard< std::mutex > lock( s_mutex );
+			auto& properties = s_properties[ type.GetID() ];
+			if ( !properties )
+			{
+				properties = CreatePropertiesById( type );
+			}
+
+			localProperties = properties.get();
+			return *properties;
+		}
+
+		static std::unique_ptr< std::unordered_map< ID, const Property* > > CreatePropertiesById( const Type& type )
+		{
+			auto properties = std::make_unique< std::unordered_map< ID, const Property* > >();
+			for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+			{
+				properties->emplace( type.GetProperty( i )->GetID(), type.GetProperty( i ) );
+			}
+
+			return properties;
+		}
+
+		template< class T >
+		static void WriteBigEndian( internal::BinaryStreamWriter& writer, T value )
+		{
+			uint8_t bytes[ sizeof( T ) ];
+			for ( size_t i = 0u; i < sizeof( T ); ++i )
+			{
+				bytes[ i ] = static_cast< uint8_t >( static_cast< uint64 >( value ) >> ( 8u * ( sizeof( T ) - 1u - i ) ) );
+			}
+
+			writer.Write( bytes, sizeof( T ) );
+		}
+
+		static void WriteTag( internal::BinaryStreamWriter& writer, uint8_t tag )
+		{
+			writer.WriteValue( tag );
+		}
+
+		static void WriteUnsigned( internal::BinaryStreamWriter& writer, uint64 value )
+		{
+			if ( value < 0x80u )
+			{
+				WriteTag( writer, static_cast< uint8_t >( value ) );
+			}
+			else if ( value <= 0xFFu )
+			{
+				WriteTag( writer, 0xCC );
+				WriteBigEndian( writer, static_cast< uint8_t >( value ) );
+			}
+			else if ( value <= 0xFFFFu )
+			{
+				WriteTag( writer, 0xCD );
+				WriteBigEndian( writer, static_cast< uint16_t >( value ) );
+			}
+			else if ( value <= 0xFFFFFFFFu )
+			{
+				WriteTag( writer, 0xCE );
+				WriteBigEndian( writer, static_cast< uint32_t >( value ) );
+			}
+			else
+			{
+				WriteTag( writer, 0xCF );
+				WriteBigEndian( writer, value );
+			}
+		}
+
+		static void WriteSigned( internal::BinaryStreamWriter& writer, int64 value )
+		{
+			if ( value >= 0 )
+			{
+				WriteUnsigned( writer, static_cast< uint64 >( value ) );
+			}
+			else if ( value >= -32 )
+			{
+				WriteTag( writer, static_cast< uint8_t >( value ) );
+			}
+			else if ( value >= std::numeric_limits< int8_t >::min() )
+			{
+				WriteTag( writer, 0xD0 );
+				WriteBigEndian( writer, static_cast< int8_t >( value ) );
+			}
+			else if ( value >= std::numeric_limits< int16_t >::min() )
+			{
+				WriteTag( writer, 0xD1 );
+				WriteBigEndian( writer, static_cast< int16_t >( value ) );
+			}
+			else if ( value >= std::numeric_limits< int32_t >::min() )
+			{
+				WriteTag( writer, 0xD2 );
+				WriteBigEndian( writer, static_cast< int32_t >( value ) );
+			}
+			else
+			{
+				WriteTag( writer, 0xD3 );
+				WriteBigEndian( writer, value );
+			}
+		}
+
+		// Writes header of a family with fixed, 8 (if available), 16 and 32 bits length variants.
+		static void WriteHeader( internal::BinaryStreamWriter& writer, size_t length, uint8_t fixTag, size_t fixLimit, uint8_t tag8, uint8_t tag16, uint8_t tag32 )
+		{
+			if ( length < fixLimit )
+			{
+				WriteTag( writer, static_cast< uint8_t >( fixTag | length ) );
+			}
+			else if ( tag8 != 0u && length <= 0xFFu )
+			{
+				WriteTag( writer, tag8 );
+				WriteBigEndian( writer, static_cast< uint8_t >( length ) );
+			}
+			else if ( length <= 0xFFFFu )
+			{
+				WriteTag( writer, tag16 );
+				WriteBigEndian( writer, static_cast< uint16_t >( length ) );
+			}
+			else
+			{
+				WriteTag( writer, tag32 );
+				WriteBigEndian( writer, static_cast< uint32_t >( length ) );
+			}
+		}
+
+		static void WriteArrayHeader( internal::BinaryStreamWriter& writer, size_t length )
+		{
+			WriteHeader( writer, length, 0x90, 16u, 0u, 0xDC, 0xDD );
+		}
+
+		static void WriteMapHeader( internal::BinaryStreamWriter& writer, size_t length )
+		{
+			WriteHeader( writer, length, 0x80, 16u, 0u, 0xDE, 0xDF );
+		}
+
+		static void WriteString( internal::BinaryStreamWriter& writer, const std::string& str )
+		{
+			WriteHeader( writer, str.size(), 0xA0, 32u, 0xD9, 0xDA, 0xDB );
+			writer.Write( str.data(), str.size() );
+		}
+
+		static void WriteBinary( internal::BinaryStreamWriter& writer, const void* data, size_t size )
+		{
+			WriteHeader( writer, size, 0u, 0u, 0xC4, 0xC5, 0xC6 );
+			writer.Write( data, size );
+		}
+
+		static void SaveNumber( const uint8_t* address, const Type& type, internal::BinaryStreamWriter& writer )
+		{
+			switch ( internal::GetNumberKind( type ) )
+			{
+			case internal::NumberKind::Bool: WriteTag( writer, *reinterpret_cast< const bool* >( address ) ? 0xC3 : 0xC2 ); break;
+			case internal::NumberKind::Int8: WriteSigned( writer, *reinterpret_cast< const __int8* >( address ) ); break;
+			case internal::NumberKind::Int32: WriteSigned( writer, *reinterpret_cast< const __int32* >( address ) ); break;
+			case internal::NumberKind::Int64: WriteSigned( writer, *reinterpret_cast< const __int64* >( address ) ); break;
+			case internal::NumberKind::Uint16: WriteUnsigned( writer, *reinterpret_cast< const unsigned short* >( address ) ); break;
+			case internal::NumberKind::Uint32: WriteUnsigned( writer, *reinterpret_cast< const unsigned* >( address ) ); break;
+			case internal::NumberKind::Uint64: WriteUnsigned( writer, *reinterpret_cast< const unsigned long long* >( address ) ); break;
+			case internal::NumberKind::Float:
+			{
+				uint32_t bits = 0u;
+				std::memcpy( &bits, address, sizeof( bits ) );
+				WriteTag( writer, 0xCA );
+				WriteBigEndian( writer, bits );
+				break;
+			}
+			case internal::NumberKind::Double:
+			{
+				uint64 bits = 0u;
+				std::memcpy( &bits, address, sizeof( bits ) );
+				WriteTag( writer, 0xCB );
+				WriteBigEndian( writer, bits );
+				break;
+			}
+			default: WriteTag( writer, 0xC0 ); break;
+			}
+		}
+
+		static void SaveValue( const uint8_t* address, const Type& type, internal::BinaryStreamWriter& writer, KeyMode keyMode )
+		{
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+				SaveNumber( address, type, writer );
+				break;
+
+			case Type::Kind::Enum:
+				WriteSigned( writer, static_cast< int64 >( static_cast< const EnumTypeBase& >( type ).GetCurrentValue( address ) ) );
+				break;
+
+			case Type::Kind::String:
+				WriteString( writer, *reinterpret_cast< const std::string* >( address ) );
+				break;
+
+			case Type::Kind::RawPointer:
+				WriteTag( writer, 0xC0 );
+				break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), writer, keyMode );
+				break;
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				SavePointee( pointerType.GetPointedAddress( address ), pointerType.GetInternalTypeDesc().GetType(), writer, keyMode );
+				break;
+			}
+#endif
+
+			case Type::Kind::Array:
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& elementType = containerType.GetInternalTypeDesc().GetType();
+				const size_t elementsAmount = containerType.GetElementsAmount( address );
+				const void* data = containerType.GetData( address );
+				if ( data && IsBinaryPayload( elementType ) )
+				{
+					WriteBinary( writer, data, elementsAmount * elementType.GetSize() );
+					break;
+				}
+
+				WriteArrayHeader( writer, elementsAmount );
+				containerType.VisitElements( address, [ & ]( const void* element )
+					{
+						SaveValue( static_cast< const uint8_t* >( element ), elementType, writer, keyMode );
+						return VisitOutcome::Continue;
+					} );
+				break;
+			}
+
+			case Type::Kind::Map:
+			{
+				const auto& containerType = static_cast< const ContainerType& >( type );
+				const Type& pairType = containerType.GetInternalTypeDesc().GetType();
+				const Property* first = pairType.GetProperty( 0u );
+				const Property* second = pairType.GetProperty( 1u );
+				WriteMapHeader( writer, containerType.GetElementsAmount( address ) );
+				containerType.VisitElements( address, [ & ]( const void* element )
+					{
+						SaveValue( static_cast< const uint8_t* >( element ) + first->GetOffset(), first->GetType(), writer, keyMode );
+						SaveValue( static_cast< const uint8_t* >( element ) + second->GetOffset(), second->GetType(), writer, keyMode );
+						return VisitOutcome::Continue;
+					} );
+				break;
+			}
+
+			default:
+			{
+				const size_t propertiesAmount = type.GetPropertiesAmount();
+				WriteMapHeader( writer, propertiesAmount );
+				for ( size_t i = 0u; i < propertiesAmount; ++i )
+				{
+					const Property* property = type.GetProperty( i );
+					WriteUnsigned( writer, keyMode == KeyMode::PropertyId ? property->GetID() : static_cast< uint64 >( i ) );
+					SaveValue( address + property->GetOffset(), property->GetType(), writer, keyMode );
+				}
+				break;
+			}
+			}
+		}
+
+		static void SavePointee( const void* pointee, const Type& internalType, internal::BinaryStreamWriter& writer, KeyMode keyMode )
+		{
+			if ( !pointee )
+			{
+				WriteTag( writer, 0xC0 );
+				return;
+			}
+
+			const Type& trueType = internalType.GetTrueType( pointee );
+			WriteArrayHeader( writer, 2u );
+			WriteUnsigned( writer, trueType.GetID() );
+			SaveValue( static_cast< const uint8_t* >( pointee ), trueType, writer, keyMode );
+		}
+		template< class T >
+		static bool ReadBigEndian( internal::BinaryStreamReader& reader, T& outValue )
+		{
+			uint8_t bytes[ sizeof( T ) ];
+			if ( !reader.Read( bytes, sizeof( T ) ) )
+			{
+				return false;
+			}
+
+			uint64 value = 0u;
+			for ( size_t i = 0u; i < sizeof( T ); ++i )
+			{
+				value = ( value << 8u ) | bytes[ i ];
+			}
+
+			outValue = static_cast< T >( value );
+			return true;
+		}
+
+		template< class T >
+		static bool ReadLength( internal::BinaryStreamReader& reader, size_t& outLength )
+		{
+			T length = 0u;
+			if ( !ReadBigEndian( reader, length ) )
+			{
+				return false;
+			}
+
+			outLength = length;
+			return true;
+		}
+
+		static bool ReadArrayLength( uint8_t tag, internal::BinaryStreamReader& reader, size_t& outLength )
+		{
+			if ( ( tag & 0xF0u ) == 0x90u )
+			{
+				outLength = tag & 0x0Fu;
+				return true;
+			}
+
+			return tag == 0xDC ? ReadLength< uint16_t >( reader, outLength ) : tag == 0xDD && ReadLength< uint32_t >( reader, outLength );
+		}
+
+		static bool ReadMapLength( uint8_t tag, internal::BinaryStreamReader& reader, size_t& outLength )
+		{
+			if ( ( tag & 0xF0u ) == 0x80u )
+			{
+				outLength = tag & 0x0Fu;
+				return true;
+			}
+
+			return tag == 0xDE ? ReadLength< uint16_t >( reader, outLength ) : tag == 0xDF && ReadLength< uint32_t >( reader, outLength );
+		}
+
+		static bool ReadStringLength( uint8_t tag, internal::BinaryStreamReader& reader, size_t& outLength )
+		{
+			if ( ( tag & 0xE0u ) == 0xA0u )
+			{
+				outLength = tag & 0x1Fu;
+				return true;
+			}
+
+			switch ( tag )
+			{
+			case 0xD9: return ReadLength< uint8_t >( reader, outLength );
+			case 0xDA: return ReadLength< uint16_t >( reader, outLength );
+			case 0xDB: return ReadLength< uint32_t >( reader, outLength );
+			default: return false;
+			}
+		}
+
+		static bool ReadBinaryLength( uint8_t tag, internal::BinaryStreamReader& reader, size_t& outLength )
+		{
+			switch ( tag )
+			{
+			case 0xC4: return ReadLength< uint8_t >( reader, outLength );
+			case 0xC5: return ReadLength< uint16_t >( reader, outLength );
+			case 0xC6: return ReadLength< uint32_t >( reader, outLength );
+			default: return false;
+			}
+		}
+
+		// Negative values are returned as two's complement bits.
+		static bool ReadInteger( uint8_t tag, internal::BinaryStreamReader& reader, uint64& outValue, bool& outIsNegative )
+		{
+			outIsNegative = false;
+			if ( tag < 0x80u )
+			{
+				outValue = tag;
+				return true;
+			}
+
+			if ( tag >= 0xE0u )
+			{
+				outValue = static_cast< uint64 >( static_cast< int64 >( static_cast< int8_t >( tag ) ) );
+				outIsNegative = true;
+				return true;
+			}
+
+			switch ( tag )
+			{
+			case 0xCC: { uint8_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = value; return true; }
+			case 0xCD: { uint16_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = value; return true; }
+			case 0xCE: { uint32_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = value; return true; }
+			case 0xCF: return ReadBigEndian( reader, outValue );
+			case 0xD0: { int8_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = static_cast< uint64 >( static_cast< int64 >( value ) ); break; }
+			case 0xD1: { int16_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = static_cast< uint64 >( static_cast< int64 >( value ) ); break; }
+			case 0xD2: { int32_t value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = static_cast< uint64 >( static_cast< int64 >( value ) ); break; }
+			case 0xD3: { int64 value; if ( !ReadBigEndian( reader, value ) ) return false; outValue = static_cast< uint64 >( value ); break; }
+			default: return false;
+			}
+
+			outIsNegative = static_cast< int64 >( outValue ) < 0;
+			return true;
+		}
+
+		template< class T >
+		static bool StoreInteger( uint8_t* address, uint64 value, bool isNegative )
+		{
+			if ( isNegative )
+			{
+				if ( !std::is_signed_v< T > || static_cast< int64 >( value ) < static_cast< int64 >( std::numeric_limits< T >::min() ) )
+				{
+					return false;
+				}
+			}
+			else if ( value > static_cast< uint64 >( std::numeric_limits< T >::max() ) )
+			{
+				return false;
+			}
+
+			const T result = static_cast< T >( value );
+			std::memcpy( address, &result, sizeof( T ) );
+			return true;
+		}
+
+		template< class T >
+		static bool StoreFloatingPoint( uint8_t tag, uint8_t* address, internal::BinaryStreamReader& reader )
+		{
+			T result = 0;
+			if ( tag == 0xCA )
+			{
+				uint32_t bits = 0u;
+				float value = 0.0f;
+				if ( !ReadBigEndian( reader, bits ) )
+				{
+					return false;
+				}
+
+				std::memcpy( &value, &bits, sizeof( value ) );
+				result = static_cast< T >( value );
+			}
+			else if ( tag == 0xCB )
+			{
+				uint64 bits = 0u;
+				double value = 0.0;
+				if ( !ReadBigEndian( reader, bits ) )
+				{
+					return false;
+				}
+
+				std::memcpy( &value, &bits, sizeof( value ) );
+				result = static_cast< T >( value );
+			}
+			else
+			{
+				uint64 value = 0u;
+				bool isNegative = false;
+				if ( !ReadInteger( tag, reader, value, isNegative ) )
+				{
+					return false;
+				}
+
+				result = isNegative ? static_cast< T >( static_cast< int64 >( value ) ) : static_cast< T >( value );
+			}
+
+			std::memcpy( address, &result, sizeof( T ) );
+			return true;
+		}
+
+		static bool LoadNumber( uint8_t tag, uint8_t* address, const Type& type, internal::BinaryStreamReader& reader )
+		{
+			const internal::NumberKind kind = internal::GetNumberKind( type );
+			if ( kind == internal::NumberKind::Bool )
+			{
+				*reinterpret_cast< bool* >( address ) = tag == 0xC3;
+				return tag == 0xC2 || tag == 0xC3;
+			}
+
+			if ( kind == internal::NumberKind::Float )
+			{
+				return StoreFloatingPoint< float >( tag, address, reader );
+			}
+
+			if ( kind == internal::NumberKind::Double )
+			{
+				return StoreFloatingPoint< double >( tag, address, reader );
+			}
+
+			uint64 value = 0u;
+			bool isNegative = false;
+			if ( !ReadInteger( tag, reader, value, isNegative ) )
+			{
+				return false;
+			}
+
+			switch ( kind )
+			{
+			case internal::NumberKind::Int8: return StoreInteger< __int8 >( address, value, isNegative );
+			case internal::NumberKind::Int32: return StoreInteger< __int32 >( address, value, isNegative );
+			case internal::NumberKind::Int64: return StoreInteger< __int64 >( address, value, isNegative );
+			case internal::NumberKind::Uint16: return StoreInteger< unsigned short >( address, value, isNegative );
+			case internal::NumberKind::Uint32: return StoreInteger< unsigned >( address, value, isNegative );
+			case internal::NumberKind::Uint64: return StoreInteger< unsigned long long >( address, value, isNegative );
+			default: return false;
+			}
+		}
+
+		static bool SkipValue( internal::BinaryStreamReader& reader, uint32_t depth )
+		{
+			uint8_t tag = 0u;
+			if ( depth > c_maxDepth || !reader.ReadValue( tag ) )
+			{
+				return false;
+			}
+
+			size_t length = 0u;
+			if ( tag < 0x80u || tag >= 0xE0u || tag == 0xC0 || tag == 0xC2 || tag == 0xC3 )
+			{
+				return true;
+			}
+
+			if ( ReadArrayLength( tag, reader, length ) || ReadMapLength( tag, reader, length ) )
+			{
+				const size_t itemsAmount = ( tag & 0xF0u ) == 0x80u || tag == 0xDE || tag == 0xDF ? length * 2u : length;
+				for ( size_t i = 0u; i < itemsAmount; ++i )
+				{
+					if ( !SkipValue( reader, depth + 1u ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			if ( ReadStringLength( tag, reader, length ) || ReadBinaryLength( tag, reader, length ) )
+			{
+				return reader.Skip( length ) != nullptr;
+			}
+
+			switch ( tag )
+			{
+			case 0xCC: case 0xD0: return reader.Skip( 1u ) != nullptr;
+			case 0xCD: case 0xD1: return reader.Skip( 2u ) != nullptr;
+			case 0xCA: case 0xCE: case 0xD2: return reader.Skip( 4u ) != nullptr;
+			case 0xCB: case 0xCF: case 0xD3: return reader.Skip( 8u ) != nullptr;
+			case 0xD4: return reader.Skip( 2u ) != nullptr;
+			case 0xD5: return reader.Skip( 3u ) != nullptr;
+			case 0xD6: return reader.Skip( 5u ) != nullptr;
+			case 0xD7: return reader.Skip( 9u ) != nullptr;
+			case 0xD8: return reader.Skip( 17u ) != nullptr;
+			case 0xC7: return ReadLength< uint8_t >( reader, length ) && reader.Skip( length + 1u ) != nullptr;
+			case 0xC8: return ReadLength< uint16_t >( reader, length ) && reader.Skip( length + 1u ) != nullptr;
+			case 0xC9: return ReadLength< uint32_t >( reader, length ) && reader.Skip( length + 1u ) != nullptr;
+			default: return false;
+			}
+		}
+
+		static bool LoadValue( uint8_t* address, const Type& type, internal::BinaryStreamReader& reader, LoadContext& context, uint32_t depth )
+		{
+			uint8_t tag = 0u;
+			if ( depth > c_maxDepth || !reader.ReadValue( tag ) )
+			{
+				return false;
+			}
+
+			switch ( type.GetKind() )
+			{
+			case Type::Kind::Primitive:
+				return LoadNumber( tag, address, type, reader );
+
+			case Type::Kind::Enum:
+			{
+				uint64 value = 0u;
+				bool isNegative = false;
+				if ( !ReadInteger( tag, reader, value, isNegative ) )
+				{
+					return false;
+				}
+
+				EnumTypeBase::MemberDesc member;
+				member.m_value = value;
+				static_cast< const EnumTypeBase& >( type ).SetCurrentMember( address, member );
+				return true;
+			}
+
+			case Type::Kind::String:
+			{
+				size_t length = 0u;
+				if ( !ReadStringLength( tag, reader, length ) || length > reader.GetRemainingSize() )
+				{
+					return false;
+				}
+
+				reinterpret_cast< std::string* >( address )->assign( reinterpret_cast< const char* >( reader.Skip( length ) ), length );
+				return true;
+			}
+
+			case Type::Kind::RawPointer:
+				*reinterpret_cast< void** >( address ) = nullptr;
+				return tag == 0xC0;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+			case Type::Kind::UniquePointer:
+			{
+				const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+				return LoadPointee( tag, pointerType.GetInternalTypeDesc().GetType(), reader, context, depth, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			case Type::Kind::SharedPointer:
+			{
+				const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+				return LoadPointee( tag, pointerType.GetInternalTypeDesc().GetType(), reader, context, depth, [ & ]( void* pointee ) { pointerType.SetPointedAddress( address, pointee ); } );
+			}
+#endif
+
+			case Type::Kind::Array:
+			case Type::Kind::Vector:
+			case Type::Kind::Set:
+			case Type::Kind::Map:
+				return LoadContainer( tag, address, static_cast< const ContainerType& >( type ), reader, context, depth );
+
+			default:
+				return LoadObject( tag, address, type, reader, context, depth );
+			}
+		}
+
+		static bool LoadContainer( uint8_t tag, uint8_t* address, const ContainerType& type, internal::BinaryStreamReader& reader, LoadContext& context, uint32_t depth )
+		{
+			const Type& elementType = type.GetInternalTypeDesc().GetType();
+			const size_t elementSize = elementType.GetSize();
+			const bool isArray = type.GetKind() == Type::Kind::Array;
+			const auto* dynamicType = isArray ? nullptr : static_cast< const DynamicContainerType* >( &type );
+
+			size_t length = 0u;
+			if ( ReadBinaryLength( tag, reader, length ) )
+			{
+				if ( !IsBinaryPayload( elementType ) || length % elementSize != 0u || length > reader.GetRemainingSize() )
+				{
+					return false;
+				}
+
+				const size_t elementsAmount = length / elementSize;
+				if ( isArray )
+				{
+					return elementsAmount == type.GetElementsAmount( address ) && reader.Read( address, length );
+				}
+
+				dynamicType->Clear( address );
+				if ( elementsAmount > 0u )
+				{
+					dynamicType->AddDefaultElements( address, elementsAmount );
+					if ( !type.GetData( address ) )
+					{
+						return false;
+					}
+				}
+
+				return reader.Read( type.GetData( address ), length );
+			}
+
+			const bool isMap = type.GetKind() == Type::Kind::Map;
+			if ( isMap ? !ReadMapLength( tag, reader, length ) : !ReadArrayLength( tag, reader, length ) )
+			{
+				return false;
+			}
+
+			if ( isArray )
+			{
+				if ( length != type.GetElementsAmount( address ) )
+				{
+					return false;
+				}
+
+				for ( size_t i = 0u; i < length; ++i )
+				{
+					if ( !LoadValue( address + i * elementSize, elementType, reader, context, depth + 1u ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			dynamicType->Clear( address );
+			if ( length == 0u )
+			{
+				return true;
+			}
+
+			// Every element takes at least one byte, bigger amounts come from corrupted data.
+			if ( length > reader.GetRemainingSize() )
+			{
+				return false;
+			}
+
+			dynamicType->Reserve( address, length );
+			dynamicType->AddDefaultElement( address );
+			if ( type.GetData( address ) )
+			{
+				for ( size_t i = 0u; i < length; ++i )
+				{
+					if ( i > 0u )
+					{
+						dynamicType->AddDefaultElement( address );
+					}
+
+					if ( !LoadValue( static_cast< uint8_t* >( type.GetData( address ) ) + i * elementSize, elementType, reader, context, depth + 1u ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			dynamicType->Clear( address );
+			internal::ElementBuffer element( elementType );
+			for ( size_t i = 0u; i < length; ++i )
+			{
+				elementType.ConstructInPlace( element.Get() );
+				bool result = false;
+				if ( isMap )
+				{
+					const Property* first = elementType.GetProperty( 0u );
+					const Property* second = elementType.GetProperty( 1u );
+					uint8_t* pair = static_cast< uint8_t* >( element.Get() );
+					result = LoadValue( pair + first->GetOffset(), first->GetType(), reader, context, depth + 1u )
+						&& LoadValue( pair + second->GetOffset(), second->GetType(), reader, context, depth + 1u );
+				}
+				else
+				{
+					result = LoadValue( static_cast< uint8_t* >( element.Get() ), elementType, reader, context, depth + 1u );
+				}
+
+				if ( result )
+				{
+					dynamicType->EmplaceElement( address, element.Get() );
+				}
+
+				elementType.Destroy( element.Get() );
+				if ( !result )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// Unknown keys are skipped.
+		static bool LoadObject( uint8_t tag, uint8_t* address, const Type& type, internal::BinaryStreamReader& reader, LoadContext& context, uint32_t depth )
+		{
+			size_t length = 0u;
+			if ( !ReadMapLength( tag, reader, length ) )
+			{
+				return false;
+			}
+
+			const auto* propertiesById = context.m_keyMode == KeyMode::PropertyId ? &GetPropertiesById( type, context ) : nullptr;
+			for ( size_t i = 0u; i < length; ++i )
+			{
+				uint8_t keyTag = 0u;
+				uint64 key = 0u;
+				bool isNegative = false;
+				if ( !reader.ReadValue( keyTag ) || !ReadInteger( keyTag, reader, key, isNegative ) )
+				{
+					return false;
+				}
+
+				const Property* property = nullptr;
+				if ( propertiesById )
+				{
+					auto found = propertiesById->find( key );
+					property = found != propertiesById->end() ? found->second : nullptr;
+				}
+				else if ( !isNegative && key < type.GetPropertiesAmount() )
+				{
+					property = type.GetProperty( static_cast< size_t >( key ) );
+				}
+
+				const bool result = property ? LoadValue( address + property->GetOffset(), property->GetType(), reader, context, depth + 1u ) : SkipValue( reader, depth + 1u );
+				if ( !result )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template< class TSetter >
+		static bool LoadPointee( uint8_t tag, const Type& internalType, internal::BinaryStreamReader& reader, LoadContext& context, uint32_t depth, const TSetter& setter )
+		{
+			if ( tag == 0xC0 )
+			{
+				setter( nullptr );
+				return true;
+			}
+
+			size_t length = 0u;
+			uint8_t idTag = 0u;
+			uint64 typeId = 0u;
+			bool isNegative = false;
+			if ( !ReadArrayLength( tag, reader, length ) || length != 2u || !reader.ReadValue( idTag ) || !ReadInteger( idTag, reader, typeId, isNegative ) )
+			{
+				return false;
+			}
+
+			const Type* trueType = internalType.GetID() == typeId ? &internalType : ::rtti::Get().FindType( typeId );
+			if ( !trueType || ( *trueType != internalType && !trueType->InheritsFrom( internalType ) ) )
+			{
+				setter( nullptr );
+				return SkipValue( reader, depth + 1u );
+			}
+
+			void* pointee = trueType->Construct();
+			setter( pointee );
+			return pointee && LoadValue( static_cast< uint8_t* >( pointee ), *trueType, reader, context, depth + 1u );
+		}
+	};
+}
+#pragma endregion
+
+#pragma region IncrementalBinarySaver
+namespace rtti
+{
+	// Produces the same output as BinarySerializer::Save, but the work might be spread over many Step() calls.
+	// Object is walked with an explicit stack, so it can't be modified until saving is finished.
+	class IncrementalBinarySaver
+	{
+	public:
+		IncrementalBinarySaver( const void* address, const Type& type, std::vector< uint8_t >& outBuffer )
+			: m_writer( outBuffer )
+		{
+			PushPlan( static_cast< const uint8_t* >( address ), internal::TypePlan::Get( type ) );
+		}
+
+		template< class T >
+		IncrementalBinarySaver( const T& object, std::vector< uint8_t >& outBuffer )
+			: IncrementalBinarySaver( &object, GetTypeInstanceOf< T >(), outBuffer )
+		{}
+
+		// Works until the budget is exceeded or saving is finished. Returns true if saving is finished.
+		bool Step( std::chrono::nanoseconds budget )
+		{
+			const auto deadline = std::chrono::steady_clock::now() + budget;
+			size_t unitsAmount = 0u;
+			while ( !m_stack.empty() )
+			{
+				if ( unitsAmount > 0u && unitsAmount % c_unitsPerClockCheck == 0u && std::chrono::steady_clock::now() >= deadline )
+				{
+					return false;
+				}
+
+				++unitsAmount;
+				ProcessUnit();
+			}
+
+			return true;
+		}
+
+		bool IsFinished() const
+		{
+			return m_stack.empty();
+		}
+
+	private:
+		using Plan = internal::TypePlan;
+
+		static constexpr size_t c_unitsPerClockCheck = 32u;
+		static constexpr size_t c_maxBytesPerUnit = 64u * 1024u;
+
+		struct Frame
+		{
+			enum class Kind : uint8_t
+			{
+				Plan,
+				Elements,
+				Bytes
+			};
+
+			Kind m_kind = Kind::Plan;
+			const uint8_t* m_address = nullptr;
+			const Plan* m_plan = nullptr;
+			size_t m_index = 0u;
+			size_t m_count = 0u;
+			std::vector< const void* > m_elements; // Elements of non contiguous containers
+		};
+
+		void PushPlan( const uint8_t* address, const Plan& plan )
+		{
+			Frame& frame = m_stack.emplace_back();
+			frame.m_kind = Frame::Kind::Plan;
+			frame.m_address = address;
+			frame.m_plan = &plan;
+		}
+
+		void PushBytes( const void* data, size_t size )
+		{
+			if ( size == 0u )
+			{
+				return;
+			}
+
+			Frame& frame = m_stack.emplace_back();
+			frame.m_kind = Frame::Kind::Bytes;
+			frame.m_address = static_cast< const uint8_t* >( data );
+			frame.m_count = size;
+		}
+
+		void PushContainer( const uint8_t* address, const ContainerType& type, const Plan& elementPlan )
+		{
+			const size_t elementsAmount = type.GetElementsAmount( address );
+			if ( type.GetKind() != Type::Kind::Array )
+			{
+				m_writer.WriteValue( static_cast< uint64 >( elementsAmount ) );
+			}
+
+			const void* data = type.GetData( address );
+			if ( data && elementPlan.IsTriviallyCopyable() )
+			{
+				PushBytes( data, elementsAmount * elementPlan.GetType().GetSize() );
+				return;
+			}
+
+			Frame frame;
+			frame.m_kind = Frame::Kind::Elements;
+			frame.m_address = static_cast< const uint8_t* >( data );
+			frame.m_plan = &elementPlan;
+			frame.m_count = elementsAmount;
+			if ( !data )
+			{
+				frame.m_elements.reserve( elementsAmount );
+				type.VisitElements( address, [ & ]( const void* element )
+					{
+						frame.m_elements.emplace_back( element );
+						return VisitOutcome::Continue;
+					} );
+			}
+
+			m_stack.emplace_back( std::move( frame ) );
+		}
+
+		void PushPointee( const void* pointee, const Plan& internalPlan )
+		{
+			if ( !pointee )
+			{
+				m_writer.WriteValue( static_cast< ID >( 0u ) );
+				return;
+			}
+
+			const Type& trueType = internalPlan.GetType().GetTrueType( pointee );
+			m_writer.WriteValue( trueType.GetID() );
+			PushPlan( static_cast< const uint8_t* >( pointee ), trueType == internalPlan.GetType() ? internalPlan : Plan::Get( trueType ) );
+		}
+
+		// Frames might be pushed here, so the reference to the current one can't be used after that.
+		void ProcessUnit()
+		{
+			Frame& frame = m_stack.back();
+			switch ( frame.m_kind )
+			{
+			case Frame::Kind::Bytes:
+			{
+				const size_t size = std::min( frame.m_count, c_maxBytesPerUnit );
+				m_writer.Write( frame.m_address, size );
+				frame.m_address += size;
+				frame.m_count -= size;
+				if ( frame.m_count == 0u )
+				{
+					m_stack.pop_back();
+				}
+				break;
+			}
+
+			case Frame::Kind::Elements:
+			{
+				if ( frame.m_index == frame.m_count )
+				{
+					m_stack.pop_back();
+					break;
+				}
+
+				const size_t index = frame.m_index++;
+				const uint8_t* element = frame.m_elements.empty() ? frame.m_address + index * frame.m_plan->GetType().GetSize() : static_cast< const uint8_t* >( frame.m_elements[ index ] );
+				PushPlan( element, *frame.m_plan );
+				break;
+			}
+
+			case Frame::Kind::Plan:
+			{
+				const auto& ops = frame.m_plan->GetOps();
+				if ( frame.m_index == ops.size() )
+				{
+					m_stack.pop_back();
+					break;
+				}
+
+				const Plan::Op& op = ops[ frame.m_index++ ];
+				const uint8_t* opAddress = frame.m_address + op.m_offset;
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Copy:
+					PushBytes( opAddress, op.m_size );
+					break;
+
+				case Plan::OpKind::String:
+				{
+					const std::string& str = *reinterpret_cast< const std::string* >( opAddress );
+					m_writer.WriteValue( static_cast< uint64 >( str.size() ) );
+					PushBytes( str.data(), str.size() );
+					break;
+				}
+
+				case Plan::OpKind::Container:
+					PushContainer( opAddress, static_cast< const ContainerType& >( *op.m_type ), *op.m_internalPlan );
+					break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Plan::OpKind::UniquePointer:
+					PushPointee( static_cast< const UniquePtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), *op.m_internalPlan );
+					break;
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Plan::OpKind::SharedPointer:
+					PushPointee( static_cast< const SharedPtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), *op.m_internalPlan );
+					break;
+#endif
+
+				default:
+					break;
+				}
+				break;
+			}
+			}
+		}
+
+		internal::BinaryStreamWriter m_writer;
+		std::vector< Frame > m_stack;
+	};
+}
+#pragma endregion
+
+#pragma region GraphWalker
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <xmmintrin.h>
+#endif
+
+namespace rtti
+{
+	namespace internal
+	{
+		inline void Prefetch( const void* address )
+		{
+#if defined( __GNUC__ ) || defined( __clang__ )
+			__builtin_prefetch( address );
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+			_mm_prefetch( static_cast< const char* >( address ), _MM_HINT_T0 );
+#endif
+		}
+
+		// Open addressing (linear probing) set of objects identified by their address and type.
+		class ObjectSet
+		{
+		public:
+			// Returns false if the object was already in the set.
+			bool Insert( const void* address, ID typeId )
+			{
+				if ( ( m_size + 1u ) * 2u > m_slots.size() )
+				{
+					Grow();
+				}
+
+				if ( InsertInternal( address, typeId ) )
+				{
+					++m_size;
+					return true;
+				}
+
+				return false;
+			}
+
+			void Clear()
+			{
+				std::fill( m_slots.begin(), m_slots.end(), Slot() );
+				m_size = 0u;
+			}
+
+			size_t GetSize() const
+			{
+				return m_size;
+			}
+
+		private:
+			struct Slot
+			{
+				const void* m_address = nullptr;
+				ID m_typeId = 0u;
+			};
+
+			static size_t CalcHash( const void* address, ID typeId )
+			{
+				uint64 hash = static_cast< uint64 >( reinterpret_cast< uintptr_t >( address ) ) ^ ( typeId * 0x9E3779B97F4A7C15ull );
+				hash ^= hash >> 29u;
+				hash *= 0xBF58476D1CE4E5B9ull;
+				hash ^= hash >> 32u;
+				return static_cast< size_t >( hash );
+			}
+
+			bool InsertInternal( const void* address, ID typeId )
+			{
+				const size_t mask = m_slots.size() - 1u;
+				for ( size_t i = CalcHash( address, typeId ) & mask;; i = ( i + 1u ) & mask )
+				{
+					Slot& slot = m_slots[ i ];
+					if ( !slot.m_address )
+					{
+						slot = { address, typeId };
+						return true;
+					}
+
+					if ( slot.m_address == address && slot.m_typeId == typeId )
+					{
+						return false;
+					}
+				}
+			}
+
+			void Grow()
+			{
+				std::vector< Slot > oldSlots = std::move( m_slots );
+				m_slots.assign( std::max< size_t >( oldSlots.size() * 2u, 64u ), Slot() );
+				for ( const Slot& slot : oldSlots )
+				{
+					if ( slot.m_address )
+					{
+						InsertInternal( slot.m_address, slot.m_typeId );
+					}
+				}
+			}
+
+			std::vector< Slot > m_slots;
+			size_t m_size = 0u;
+		};
+	}
+
+	// Visits every object reachable from the root through raw, unique and shared pointers exactly once.
+	// Pointees are visited as their true types. Walking uses an explicit stack, so deep graphs don't overflow the call stack.
+	class GraphWalker
+	{
+	public:
+		void SetPrefetchEnabled( bool enabled )
+		{
+			m_prefetchEnabled = enabled;
+		}
+
+		// visitFunc( const void* address, const Type& type ) returns VisitOutcome. Returns amount of visited objects.
+		template< class TFunc >
+		size_t Walk( const void* address, const Type& type, const TFunc& visitFunc )
+		{
+			m_visited.Clear();
+			m_stack.clear();
+			PushObject( address, type );
+
+			while ( !m_stack.empty() )
+			{
+				const WorkItem item = m_stack.back();
+				m_stack.pop_back();
+
+				if ( item.m_plan )
+				{
+					Scan( item.m_address, *item.m_plan );
+					continue;
+				}
+
+				const Type& trueType = item.m_type->GetTrueType( item.m_address );
+				if ( !m_visited.Insert( item.m_address, trueType.GetID() ) )
+				{
+					continue;
+				}
+
+				if ( visitFunc( static_cast< const void* >( item.m_address ), trueType ) == VisitOutcome::Break )
+				{
+					break;
+				}
+
+				const internal::TypePlan& plan = internal::TypePlan::Get( trueType );
+				if ( ContainsPointers( plan ) )
+				{
+					m_stack.push_back( { item.m_address, nullptr, &plan } );
+				}
+			}
+
+			return m_visited.GetSize();
+		}
+
+	private:
+		using Plan = internal::TypePlan;
+
+		// Either an object to visit (m_type) or a memory to scan for pointers (m_plan).
+		struct WorkItem
+		{
+			const uint8_t* m_address = nullptr;
+			const Type* m_type = nullptr;
+			const Plan* m_plan = nullptr;
+		};
+
+		void PushObject( const void* address, const Type& type )
+		{
+			if ( !address )
+			{
+				return;
+			}
+
+			if ( m_prefetchEnabled )
+			{
+				internal::Prefetch( address );
+			}
+
+			m_stack.push_back( { static_cast< const uint8_t* >( address ), &type, nullptr } );
+		}
+
+		void Scan( const uint8_t* address, const Plan& plan )
+		{
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				const uint8_t* opAddress = address + op.m_offset;
+				switch ( op.m_kind )
+				{
+				case Plan::OpKind::Container:
+				{
+					const Plan& elementPlan = *op.m_internalPlan;
+					if ( ContainsPointers( elementPlan ) )
+					{
+						static_cast< const ContainerType& >( *op.m_type ).VisitElements( opAddress, [ & ]( const void* element )
+							{
+								m_stack.push_back( { static_cast< const uint8_t* >( element ), nullptr, &elementPlan } );
+								return VisitOutcome::Continue;
+							} );
+					}
+					break;
+				}
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Plan::OpKind::UniquePointer:
+					PushObject( static_cast< const UniquePtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), op.m_internalPlan->GetType() );
+					break;
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Plan::OpKind::SharedPointer:
+					PushObject( static_cast< const SharedPtrBaseType& >( *op.m_type ).GetPointedAddress( opAddress ), op.m_internalPlan->GetType() );
+					break;
+#endif
+
+				case Plan::OpKind::RawPointer:
+					PushObject( *reinterpret_cast< const void* const* >( opAddress ), static_cast< const PointerType<>& >( *op.m_type ).GetInternalTypeDesc().GetType() );
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+
+		// Plans which reference themselves (e.g. through containers) are conservatively treated as containing pointers.
+		bool ContainsPointers( const Plan& plan )
+		{
+			auto found = m_containsPointers.find( &plan );
+			if ( found != m_containsPointers.end() )
+			{
+				return found->second;
+			}
+
+			m_containsPointers.emplace( &plan, true );
+			bool result = false;
+			for ( const Plan::Op& op : plan.GetOps() )
+			{
+				if ( op.m_kind == Plan::OpKind::UniquePointer || op.m_kind == Plan::OpKind::SharedPointer || op.m_kind == Plan::OpKind::RawPointer
+					|| ( op.m_kind == Plan::OpKind::Container && ContainsPointers( *op.m_internalPlan ) ) )
+				{
+					result = true;
+					break;
+				}
+			}
+
+			m_containsPointers[ &plan ] = result;
+			return result;
+		}
+
+		internal::ObjectSet m_visited;
+		std::vector< WorkItem > m_stack;
+		std::unordered_map< const Plan*, bool > m_containsPointers;
+		bool m_prefetchEnabled = true;
+	};
+}
+#pragma endregion
+
+#pragma region DeepClone
+namespace rtti
+{
+	namespace internal
+	{
+		class DeepCloner
+		{
+		public:
+			// Destination has to be already constructed.
+			void Clone( const void* source, void* destination, const Type& type )
+			{
+				RegisterRange( source, destination, type.GetSize() );
+				CloneWithPlan( static_cast< const uint8_t* >( source ), static_cast< uint8_t* >( destination ), TypePlan::Get( type ) );
+				RemapRawPointers();
+				EmplacePendingElements();
+			}
+
+		private:
+			using Plan = TypePlan;
+
+			// Memory of a cloned object or a contiguous container's buffer.
+			struct Range
+			{
+				const uint8_t* m_source = nullptr;
+				uint8_t* m_destination = nullptr;
+				size_t m_size = 0u;
+			};
+
+			struct SharedClone
+			{
+				std::shared_ptr< void > m_owner;
+				void* m_address = nullptr;
+			};
+
+			struct RawPointerFixup
+			{
+				void** m_destination = nullptr;
+				const uint8_t* m_sourceValue = nullptr;
+			};
+
+			// Cloned element of a non contiguous container, kept until raw pointers inside of it are remapped.
+			struct PendingElement
+			{
+				const DynamicContainerType* m_containerType = nullptr;
+				uint8_t* m_container = nullptr;
+				std::unique_ptr< ElementBuffer > m_element;
+			};
+
+			void RegisterRange( const void* source, void* destination, size_t size )
+			{
+				if ( size > 0u )
+				{
+					m_ranges.push_back( { static_cast< const uint8_t* >( source ), static_cast< uint8_t* >( destination ), size } );
+				}
+			}
+
+			void CloneWithPlan( const uint8_t* source, uint8_t* destination, const Plan& plan )
+			{
+				for ( const Plan::Op& op : plan.GetOps() )
+				{
+					const uint8_t* opSource = source + op.m_offset;
+					uint8_t* opDestination = destination + op.m_offset;
+					switch ( op.m_kind )
+					{
+					case Plan::OpKind::Copy:
+						std::memcpy( opDestination, opSource, op.m_size );
+						break;
+
+					case Plan::OpKind::String:
+						*reinterpret_cast< std::string* >( opDestination ) = *reinterpret_cast< const std::string* >( opSource );
+						break;
+
+					case Plan::OpKind::Container:
+						CloneContainer( opSource, opDestination, static_cast< const ContainerType& >( *op.m_type ), *op.m_internalPlan );
+						break;
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+					case Plan::OpKind::UniquePointer:
+					{
+						const auto& pointerType = static_cast< const UniquePtrBaseType& >( *op.m_type );
+						pointerType.SetPointedAddress( opDestination, ClonePointee( pointerType.GetPointedAddress( opSource ), op.m_internalPlan->GetType() ) );
+						break;
+					}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+					case Plan::OpKind::SharedPointer:
+						CloneSharedPointer( opSource, opDestination, static_cast< const SharedPtrBaseType& >( *op.m_type ), op.m_internalPlan->GetType() );
+						break;
+#endif
+
+					case Plan::OpKind::RawPointer:
+						m_rawPointers.push_back( { reinterpret_cast< void** >( opDestination ), *reinterpret_cast< const uint8_t* const* >( opSource ) } );
+						break;
+
+					default:
+						break;
+					}
+				}
+			}
+
+			void CloneContainer( const uint8_t* source, uint8_t* destination, const ContainerType& type, const Plan& elementPlan )
+			{
+				const Type& elementType = elementPlan.GetType();
+				const size_t elementSize = elementType.GetSize();
+				const size_t elementsAmount = type.GetElementsAmount( source );
+				const uint8_t* sourceData = static_cast< const uint8_t* >( type.GetData( source ) );
+
+				if ( type.GetKind() != Type::Kind::Array )
+				{
+					const auto& dynamicType = static_cast< const DynamicContainerType& >( type );
+					dynamicType.Clear( destination );
+					if ( elementsAmount == 0u )
+					{
+						return;
+					}
+
+					if ( !sourceData )
+					{
+						// Elements of non contiguous containers are cloned into temporary elements, emplaced after remapping raw pointers.
+						type.VisitElements( source, [ & ]( const void* sourceElement )
+							{
+								auto element = std::make_unique< ElementBuffer >( elementType );
+								elementType.ConstructInPlace( element->Get() );
+								CloneWithPlan( static_cast< const uint8_t* >( sourceElement ), static_cast< uint8_t* >( element->Get() ), elementPlan );
+								m_pendingElements.push_back( { &dynamicType, destination, std::move( element ) } );
+								return VisitOutcome::Continue;
+							} );
+						return;
+					}
+
+					dynamicType.AddDefaultElements( destination, elementsAmount );
+				}
+
+				uint8_t* destinationData = static_cast< uint8_t* >( type.GetData( destination ) );
+				if ( type.GetKind() != Type::Kind::Array )
+				{
+					RegisterRange( sourceData, destinationData, elementsAmount * elementSize );
+				}
+
+				if ( elementPlan.IsTriviallyCopyable() )
+				{
+					std::memcpy( destinationData, sourceData, elementsAmount * elementSize );
+					return;
+				}
+
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					CloneWithPlan( sourceData + i * elementSize, destinationData + i * elementSize, elementPlan );
+				}
+			}
+
+			void* ClonePointee( const void* pointee, const Type& internalType )
+			{
+				if ( !pointee )
+				{
+					return nullptr;
+				}
+
+				const Type& trueType = internalType.GetTrueType( pointee );
+				void* clone = trueType.Construct();
+				RegisterRange( pointee, clone, trueType.GetSize() );
+				CloneWithPlan( static_cast< const uint8_t* >( pointee ), static_cast< uint8_t* >( clone ), Plan::Get( trueType ) );
+				return clone;
+			}
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+			// Every shared pointee is cloned once, so aliasing between shared pointers is preserved.
+			void CloneSharedPointer( const uint8_t* source, uint8_t* destination, const SharedPtrBaseType& type, const Type& internalType )
+			{
+				const void* pointee = type.GetPointedAddress( source );
+				if ( !pointee )
+				{
+					type.SetPointedAddress( destination, nullptr );
+					return;
+				}
+
+				auto found = m_sharedClones.find( pointee );
+				if ( found != m_sharedClones.end() )
+				{
+					type.SetSharedPointer( destination, found->second.m_owner, found->second.m_address );
+					return;
+				}
+
+				const Type& trueType = internalType.GetTrueType( pointee );
+				void* clone = trueType.Construct();
+				type.SetPointedAddress( destination, clone );
+
+				// Registered before cloning the pointee to handle cycles.
+				m_sharedClones.emplace( pointee, SharedClone{ type.GetSharedPointer( destination ), clone } );
+				RegisterRange( pointee, clone, trueType.GetSize() );
+				CloneWithPlan( static_cast< const uint8_t* >( pointee ), static_cast< uint8_t* >( clone ), Plan::Get( trueType ) );
+			}
+#endif
+
+			// Raw pointers to memory of cloned objects are redirected to the clones, others are copied as they are.
+			void RemapRawPointers()
+			{
+				std::sort( m_ranges.begin(), m_ranges.end(), []( const Range& lhs, const Range& rhs ) { return lhs.m_source < rhs.m_source; } );
+				for ( const RawPointerFixup& fixup : m_rawPointers )
+				{
+					auto range = std::upper_bound( m_ranges.begin(), m_ranges.end(), fixup.m_sourceValue, []( const uint8_t* value, const Range& range ) { return value < range.m_source; } );
+					if ( range != m_ranges.begin() && fixup.m_sourceValue < ( --range )->m_source + range->m_size )
+					{
+						*fixup.m_destination = range->m_destination + ( fixup.m_sourceValue - range->m_source );
+					}
+					else
+					{
+						*fixup.m_destination = const_cast< uint8_t* >( fixup.m_sourceValue );
+					}
+				}
+			}
+
+			// Elements of nested containers were registered before elements containing them, so they are emplaced first.
+			void EmplacePendingElements()
+			{
+				for ( PendingElement& pending : m_pendingElements )
+				{
+					const Type& elementType = pending.m_containerType->GetInternalTypeDesc().GetType();
+					pending.m_containerType->EmplaceElement( pending.m_container, pending.m_element->Get() );
+					elementType.Destroy( pending.m_element->Get() );
+				}
+
+				m_pendingElements.clear();
+			}
+
+			std::vector< Range > m_ranges;
+			std::vector< RawPointerFixup > m_rawPointers;
+			std::unordered_map< const void*, SharedClone > m_sharedClones;
+			std::vector< PendingElement > m_pendingElements;
+		};
+	}
+
+	// Clones the whole graph of objects reachable from the source into already constructed destination.
+	inline void DeepCloneInto( const void* source, void* destination, const Type& type )
+	{
+		internal::DeepCloner().Clone( source, destination, type );
+	}
+
+	// Returns a new object created with type.Construct().
+	inline void* DeepClone( const void* address, const Type& type )
+	{
+		void* clone = type.Construct();
+		DeepCloneInto( address, clone, type );
+		return clone;
+	}
+
+	// Polymorphic objects are cloned as their true types.
+	template< class T >
+	std::unique_ptr< T > DeepClone( const T& object )
+	{
+		const Type& trueType = GetTypeInstanceOf< T >().GetTrueType( &object );
+		return std::unique_ptr< T >( static_cast< T* >( DeepClone( &object, trueType ) ) );
+	}
+}
+#pragma endregion
+
+#pragma region Delta
+namespace rtti
+{
+	namespace internal
+	{
+		// Patch of an object is a bitmask of its changed properties followed by their patches. Arrays and vectors are patched by index,
+		// sets and maps by key. Values that can't be patched partially are stored in BinarySerializer's format.
+		class Delta
+		{
+		public:
+			static bool Diff( const void* oldAddress, const void* newAddress, const Type& type, std::vector< uint8_t >& outPatch )
+			{
+				outPatch.clear();
+				BinaryStreamWriter writer( outPatch );
+				return WritePatch( static_cast< const uint8_t* >( oldAddress ), static_cast< const uint8_t* >( newAddress ), type, writer );
+			}
+
+			static bool ApplyPatch( void* address, const Type& type, const uint8_t* data, size_t size )
+			{
+				if ( size == 0u )
+				{
+					return true;
+				}
+
+				BinaryStreamReader reader( data, size );
+				return ReadPatch( static_cast< uint8_t* >( address ), type, reader ) && reader.GetRemainingSize() == 0u;
+			}
+
+		private:
+			enum class Mode : uint8_t
+			{
+				Patch,
+				Full
+			};
+
+			static bool IsClassLike( const Type& type )
+			{
+				const Type::Kind kind = type.GetKind();
+				return kind == Type::Kind::Class || kind == Type::Kind::Struct || kind == Type::Kind::RuntimeType;
+			}
+
+			static std::string Serialize( const void* address, const Type& type )
+			{
+				std::vector< uint8_t > buffer;
+				BinarySerializer::Save( address, type, buffer );
+				return std::string( buffer.begin(), buffer.end() );
+			}
+
+			static void WriteBytes( const std::string& bytes, BinaryStreamWriter& writer )
+			{
+				writer.WriteValue( static_cast< uint64 >( bytes.size() ) );
+				writer.Write( bytes.data(), bytes.size() );
+			}
+
+			static bool ReadBytes( std::string& outBytes, BinaryStreamReader& reader )
+			{
+				uint64 size = 0u;
+				if ( !reader.ReadValue( size ) || size > reader.GetRemainingSize() )
+				{
+					return false;
+				}
+
+				const uint8_t* bytes = reader.Skip( static_cast< size_t >( size ) );
+				outBytes.assign( bytes, bytes + size );
+				return true;
+			}
+
+			static bool LoadFull( void* address, const Type& type, BinaryStreamReader& reader )
+			{
+				size_t readSize = 0u;
+				const bool result = BinarySerializer::Load( address, type, reader.Skip( 0u ), reader.GetRemainingSize(), &readSize );
+				reader.Skip( readSize );
+				return result;
+			}
+
+			static void MarkChanged( BinaryStreamWriter& writer, size_t maskPosition, size_t index )
+			{
+				writer.GetBuffer()[ maskPosition + index / 8u ] |= static_cast< uint8_t >( 1u << ( index % 8u ) );
+			}
+
+			static bool IsMarked( const uint8_t* mask, size_t index )
+			{
+				return ( mask[ index / 8u ] & ( 1u << ( index % 8u ) ) ) != 0u;
+			}
+
+			// Writes patch and returns true if values differ, writes nothing otherwise.
+			static bool WritePatch( const uint8_t* oldAddress, const uint8_t* newAddress, const Type& type, BinaryStreamWriter& writer )
+			{
+				if ( TypePlan::Get( type ).IsTriviallyCopyable() && std::memcmp( oldAddress, newAddress, type.GetSize() ) == 0 )
+				{
+					return false;
+				}
+
+				switch ( type.GetKind() )
+				{
+				case Type::Kind::Primitive:
+				case Type::Kind::Enum:
+					writer.Write( newAddress, type.GetSize() );
+					return true;
+
+				case Type::Kind::String:
+					if ( *reinterpret_cast< const std::string* >( oldAddress ) == *reinterpret_cast< const std::string* >( newAddress ) )
+					{
+						return false;
+					}
+
+					BinarySerializer::Save( newAddress, type, writer.GetBuffer() );
+					return true;
+
+				case Type::Kind::RawPointer:
+					// Raw pointers are not serialized.
+					return false;
+
+				case Type::Kind::Array:
+					return WriteArrayPatch( oldAddress, newAddress, static_cast< const ContainerType& >( type ), writer );
+
+				case Type::Kind::Vector:
+					return WriteVectorPatch( oldAddress, newAddress, static_cast< const ContainerType& >( type ), writer );
+
+				case Type::Kind::Set:
+					return WriteSetPatch( oldAddress, newAddress, static_cast< const ContainerType& >( type ), writer );
+
+				case Type::Kind::Map:
+					return WriteMapPatch( oldAddress, newAddress, static_cast< const ContainerType& >( type ), writer );
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Type::Kind::UniquePointer:
+				{
+					const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+					return WritePointerPatch( newAddress, pointerType.GetPointedAddress( oldAddress ), pointerType.GetPointedAddress( newAddress ), type, pointerType.GetInternalTypeDesc().GetType(), writer );
+				}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Type::Kind::SharedPointer:
+				{
+					const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+					return WritePointerPatch( newAddress, pointerType.GetPointedAddress( oldAddress ), pointerType.GetPointedAddress( newAddress ), type, pointerType.GetInternalTypeDesc().GetType(), writer );
+				}
+#endif
+
+				default:
+					return IsClassLike( type ) ? WriteObjectPatch( oldAddress, newAddress, type, writer ) : WriteFull( oldAddress, newAddress, type, writer );
+				}
+			}
+
+			static bool WriteFull( const uint8_t* oldAddress, const uint8_t* newAddress, const Type& type, BinaryStreamWriter& writer )
+			{
+				std::vector< uint8_t >& buffer = writer.GetBuffer();
+				const size_t start = buffer.size();
+				BinarySerializer::Save( newAddress, type, buffer );
+
+				std::vector< uint8_t > oldBuffer;
+				BinarySerializer::Save( oldAddress, type, oldBuffer );
+				if ( oldBuffer.size() == buffer.size() - start && std::equal( oldBuffer.begin(), oldBuffer.end(), buffer.begin() + start ) )
+				{
+					buffer.resize( start );
+					return false;
+				}
+
+				return true;
+			}
+
+			static bool WriteObjectPatch( const uint8_t* oldAddress, const uint8_t* newAddress, const Type& type, BinaryStreamWriter& writer )
+			{
+				std::vector< uint8_t >& buffer = writer.GetBuffer();
+				const size_t maskPosition = buffer.size();
+				const size_t propertiesAmount = type.GetPropertiesAmount();
+				buffer.resize( maskPosition + ( propertiesAmount + 7u ) / 8u, 0u );
+
+				bool changed = false;
+				for ( size_t i = 0u; i < propertiesAmount; ++i )
+				{
+					const Property* property = type.GetProperty( i );
+					if ( WritePatch( oldAddress + property->GetOffset(), newAddress + property->GetOffset(), property->GetType(), writer ) )
+					{
+						MarkChanged( writer, maskPosition, i );
+						changed = true;
+					}
+				}
+
+				if ( !changed )
+				{
+					buffer.resize( maskPosition );
+				}
+
+				return changed;
+			}
+
+			// Patches elements at common indices, writes mask of changed ones first.
+			static bool WriteElementsPatch( const uint8_t* oldData, const uint8_t* newData, size_t elementsAmount, const Type& elementType, BinaryStreamWriter& writer )
+			{
+				std::vector< uint8_t >& buffer = writer.GetBuffer();
+				const size_t maskPosition = buffer.size();
+				buffer.resize( maskPosition + ( elementsAmount + 7u ) / 8u, 0u );
+
+				const size_t elementSize = elementType.GetSize();
+				bool changed = false;
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					if ( WritePatch( oldData + i * elementSize, newData + i * elementSize, elementType, writer ) )
+					{
+						MarkChanged( writer, maskPosition, i );
+						changed = true;
+					}
+				}
+
+				return changed;
+			}
+
+			static bool WriteArrayPatch( const uint8_t* oldAddress, const uint8_t* newAddress, const ContainerType& type, BinaryStreamWriter& writer )
+			{
+				const size_t start = writer.GetBuffer().size();
+				const bool changed = WriteElementsPatch( static_cast< const uint8_t* >( type.GetData( oldAddress ) ), static_cast< const uint8_t* >( type.GetData( newAddress ) ),
+					type.GetElementsAmount( newAddress ), type.GetInternalTypeDesc().GetType(), writer );
+				if ( !changed )
+				{
+					writer.GetBuffer().resize( start );
+				}
+
+				return changed;
+			}
+
+			static bool WriteVectorPatch( const uint8_t* oldAddress, const uint8_t* newAddress, const ContainerType& type, BinaryStreamWriter& writer )
+			{
+				const size_t oldAmount = type.GetElementsAmount( oldAddress );
+				const size_t newAmount = type.GetElementsAmount( newAddress );
+				const uint8_t* oldData = static_cast< const uint8_t* >( type.GetData( oldAddress ) );
+				const uint8_t* newData = static_cast< const uint8_t* >( type.GetData( newAddress ) );
+
+				std::vector< uint8_t >& buffer = writer.GetBuffer();
+				const size_t start = buffer.size();
+				if ( ( oldAmount > 0u && !oldData ) || ( newAmount > 0u && !newData ) )
+				{
+					// Elements can't be accessed by index.
+					writer.WriteValue( Mode::Full );
+					if ( !WriteFull( oldAddress, newAddress, type, writer ) )
+					{
+						buffer.resize( start );
+						return false;
+					}
+
+					return true;
+				}
+
+				writer.WriteValue( Mode::Patch );
+				writer.WriteValue( static_cast< uint64 >( oldAmount ) );
+				writer.WriteValue( static_cast< uint64 >( newAmount ) );
+
+				const Type& elementType = type.GetInternalTypeDesc().GetType();
+				const bool changed = WriteElementsPatch( oldData, newData, std::min( oldAmount, newAmount ), elementType, writer );
+				if ( !changed && oldAmount == newAmount )
+				{
+					buffer.resize( start );
+					return false;
+				}
+
+				for ( size_t i = oldAmount; i < newAmount; ++i )
+				{
+					BinarySerializer::Save( newData + i * elementType.GetSize(), elementType, buffer );
+				}
+
+				return true;
+			}
+
+			static bool WriteSetPatch( const uint8_t* oldAddress, const uint8_t* newAddress, const ContainerType& type, BinaryStreamWriter& writer )
+			{
+				const Type& elementType = type.GetInternalTypeDesc().GetType();
+				auto collect = [ & ]( const uint8_t* address )
+					{
+						std::unordered_set< std::string > elements;
+						type.VisitElements( address, [ & ]( const void* element )
+							{
+								elements.emplace( Serialize( element, elementType ) );
+								return VisitOutcome::Continue;
+							} );
+						return elements;
+					};
+
+				const std::unordered_set< std::string > oldElements = collect( oldAddress );
+				const std::unordered_set< std::string > newElements = collect( newAddress );
+				auto writeMissing = [ & ]( const std::unordered_set< std::string >& elements, const std::unordered_set< std::string >& other )
+					{
+						std::vector< const std::string* > missing;
+						for ( const std::string& element : elements )
+						{
+							if ( other.find( element ) == other.end() )
+							{
+								missing.push_back( &element );
+							}
+						}
+
+						writer.WriteValue( static_cast< uint64 >( missing.size() ) );
+						for ( const std::string* element : missing )
+						{
+							WriteBytes( *element, writer );
+						}
+
+						return !missing.empty();
+					};
+
+				const size_t start = writer.GetBuffer().size();
+				const bool removed = writeMissing( oldElements, newElements );
+				const bool added = writeMissing( newElements, oldElements );
+				if ( !removed && !added )
+				{
+					writer.GetBuffer().resize( start );
+					return false;
+				}
+
+				return true;
+			}
+
+			static bool WriteMapPatch( const uint8_t* oldAddress, const uint8_t* newAddress, const ContainerType& type, BinaryStreamWriter& writer )
+			{
+				const Type& pairType = type.GetInternalTypeDesc().GetType();
+				const Property& keyProperty = *pairType.GetProperty( 0u );
+				const Property& valueProperty = *pairType.GetProperty( 1u );
+
+				std::unordered_map< std::string, const uint8_t* > oldPairs;
+				type.VisitElements( oldAddress, [ & ]( const void* pair )
+					{
+						const uint8_t* bytes = static_cast< const uint8_t* >( pair );
+						oldPairs.emplace( Serialize( bytes + keyProperty.GetOffset(), keyProperty.GetType() ), bytes );
+						return VisitOutcome::Continue;
+					} );
+
+				std::vector< std::pair< std::string, const uint8_t* > > newPairs;
+				std::unordered_set< std::string > newKeys;
+				type.VisitElements( newAddress, [ & ]( const void* pair )
+					{
+						const uint8_t* bytes = static_cast< const uint8_t* >( pair );
+						newPairs.emplace_back( Serialize( bytes + keyProperty.GetOffset(), keyProperty.GetType() ), bytes );
+						newKeys.emplace( newPairs.back().first );
+						return VisitOutcome::Continue;
+					} );
+
+				std::vector< uint8_t >& buffer = writer.GetBuffer();
+				const size_t start = buffer.size();
+				writer.WriteValue( static_cast< uint64 >( 0u ) );
+				uint64 removedAmount = 0u;
+				for ( const auto& oldPair : oldPairs )
+				{
+					if ( newKeys.find( oldPair.first ) == newKeys.end() )
+					{
+						WriteBytes( oldPair.first, writer );
+						++removedAmount;
+					}
+				}
+
+				std::memcpy( buffer.data() + start, &removedAmount, sizeof( removedAmount ) );
+
+				const size_t changedAmountPosition = buffer.size();
+				writer.WriteValue( static_cast< uint64 >( 0u ) );
+				uint64 changedAmount = 0u;
+				for ( const auto& newPair : newPairs )
+				{
+					const size_t pairStart = buffer.size();
+					WriteBytes( newPair.first, writer );
+
+					auto found = oldPairs.find( newPair.first );
+					if ( found == oldPairs.end() )
+					{
+						writer.WriteValue( Mode::Full );
+						BinarySerializer::Save( newPair.second + valueProperty.GetOffset(), valueProperty.GetType(), buffer );
+						++changedAmount;
+						continue;
+					}
+
+					writer.WriteValue( Mode::Patch );
+					if ( WritePatch( found->second + valueProperty.GetOffset(), newPair.second + valueProperty.GetOffset(), valueProperty.GetType(), writer ) )
+					{
+						++changedAmount;
+					}
+					else
+					{
+						buffer.resize( pairStart );
+					}
+				}
+
+				std::memcpy( buffer.data() + changedAmountPosition, &changedAmount, sizeof( changedAmount ) );
+				if ( removedAmount == 0u && changedAmount == 0u )
+				{
+					buffer.resize( start );
+					return false;
+				}
+
+				return true;
+			}
+
+			// Pointees of the same true type are patched in place, otherwise the whole pointer is stored.
+			static bool WritePointerPatch( const uint8_t* newAddress, const void* oldPointee, const void* newPointee, const Type& type, const Type& internalType, BinaryStreamWriter& writer )
+			{
+				if ( oldPointee == newPointee )
+				{
+					return false;
+				}
+
+				if ( oldPointee && newPointee )
+				{
+					const Type& trueType = internalType.GetTrueType( newPointee );
+					if ( internalType.GetTrueType( oldPointee ) == trueType )
+					{
+						const size_t start = writer.GetBuffer().size();
+						writer.WriteValue( Mode::Patch );
+						writer.WriteValue( trueType.GetID() );
+						if ( WritePatch( static_cast< const uint8_t* >( oldPointee ), static_cast< const uint8_t* >( newPointee ), trueType, writer ) )
+						{
+							return true;
+						}
+
+						writer.GetBuffer().resize( start );
+						return false;
+					}
+				}
+
+				writer.WriteValue( Mode::Full );
+				BinarySerializer::Save( newAddress, type, writer.GetBuffer() );
+				return true;
+			}
+
+			static bool ReadPatch( uint8_t* address, const Type& type, BinaryStreamReader& reader )
+			{
+				switch ( type.GetKind() )
+				{
+				case Type::Kind::Primitive:
+				case Type::Kind::Enum:
+					return reader.Read( address, type.GetSize() );
+
+				case Type::Kind::String:
+					return LoadFull( address, type, reader );
+
+				case Type::Kind::RawPointer:
+					return false;
+
+				case Type::Kind::Array:
+				{
+					const auto& arrayType = static_cast< const ContainerType& >( type );
+					return ReadElementsPatch( static_cast< uint8_t* >( arrayType.GetData( address ) ), arrayType.GetElementsAmount( address ), arrayType.GetInternalTypeDesc().GetType(), reader );
+				}
+
+				case Type::Kind::Vector:
+					return ReadVectorPatch( address, static_cast< const DynamicContainerType& >( type ), reader );
+
+				case Type::Kind::Set:
+					return ReadSetPatch( address, static_cast< const DynamicContainerType& >( type ), reader );
+
+				case Type::Kind::Map:
+					return ReadMapPatch( address, static_cast< const DynamicContainerType& >( type ), reader );
+
+#if RTTI_CFG_CREATE_STD_UNIQUEPTR_TYPE
+				case Type::Kind::UniquePointer:
+				{
+					const auto& pointerType = static_cast< const UniquePtrBaseType& >( type );
+					return ReadPointerPatch( address, pointerType.GetPointedAddress( address ), type, pointerType.GetInternalTypeDesc().GetType(), reader );
+				}
+#endif
+
+#if RTTI_CFG_CREATE_STD_SHAREDPTR_TYPE
+				case Type::Kind::SharedPointer:
+				{
+					const auto& pointerType = static_cast< const SharedPtrBaseType& >( type );
+					return ReadPointerPatch( address, pointerType.GetPointedAddress( address ), type, pointerType.GetInternalTypeDesc().GetType(), reader );
+				}
+#endif
+
+				default:
+					return IsClassLike( type ) ? ReadObjectPatch( address, type, reader ) : LoadFull( address, type, reader );
+				}
+			}
+
+			static bool ReadObjectPatch( uint8_t* address, const Type& type, BinaryStreamReader& reader )
+			{
+				const size_t propertiesAmount = type.GetPropertiesAmount();
+				const uint8_t* mask = reader.Skip( ( propertiesAmount + 7u ) / 8u );
+				if ( !mask )
+				{
+					return false;
+				}
+
+				for ( size_t i = 0u; i < propertiesAmount; ++i )
+				{
+					if ( IsMarked( mask, i ) )
+					{
+						const Property* property = type.GetProperty( i );
+						if ( !ReadPatch( address + property->GetOffset(), property->GetType(), reader ) )
+						{
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+
+			static bool ReadElementsPatch( uint8_t* data, size_t elementsAmount, const Type& elementType, BinaryStreamReader& reader )
+			{
+				const uint8_t* mask = reader.Skip( ( elementsAmount + 7u ) / 8u );
+				if ( !mask )
+				{
+					return false;
+				}
+
+				for ( size_t i = 0u; i < elementsAmount; ++i )
+				{
+					if ( IsMarked( mask, i ) && !ReadPatch( data + i * elementType.GetSize(), elementType, reader ) )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool ReadVectorPatch( uint8_t* address, const DynamicContainerType& type, BinaryStreamReader& reader )
+			{
+				Mode mode = Mode::Patch;
+				if ( !reader.ReadValue( mode ) )
+				{
+					return false;
+				}
+
+				if ( mode == Mode::Full )
+				{
+					return LoadFull( address, type, reader );
+				}
+
+				uint64 oldAmount = 0u;
+				uint64 newAmount = 0u;
+				if ( mode != Mode::Patch || !reader.ReadValue( oldAmount ) || !reader.ReadValue( newAmount ) || oldAmount != type.GetElementsAmount( address ) )
+				{
+					return false;
+				}
+
+				const Type& elementType = type.GetInternalTypeDesc().GetType();
+				if ( newAmount > oldAmount && !IsElementsAmountValid( newAmount - oldAmount, BinarySerializer::GetMinEncodedSize( TypePlan::Get( elementType ) ), reader.GetRemainingSize() ) )
+				{
+					return false;
+				}
+
+				const size_t commonAmount = static_cast< size_t >( std::min( oldAmount, newAmount ) );
+				uint8_t* data = static_cast< uint8_t* >( type.GetData( address ) );
+				if ( ( commonAmount > 0u && !data ) || !ReadElementsPatch( data, commonAmount, elementType, reader ) )
+				{
+					return false;
+				}
+
+				for ( size_t i = static_cast< size_t >( oldAmount ); i > newAmount; --i )
+				{
+					type.RemoveElementAtIndex( address, i - 1u );
+				}
+
+				if ( newAmount > oldAmount )
+				{
+					type.AddDefaultElements( address, static_cast< size_t >( newAmount - oldAmount ) );
+					data = static_cast< uint8_t* >( type.GetData( address ) );
+					for ( size_t i = static_cast< size_t >( oldAmount ); i < newAmount; ++i )
+					{
+						if ( !data || !LoadFull( data + i * elementType.GetSize(), elementType, reader ) )
+						{
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+
+			// Removes elements whose serialized keys are listed in the patch.
+			static bool RemoveElements( uint8_t* address, const DynamicContainerType& type, const std::function< std::string( const uint8_t* ) >& getKey, BinaryStreamReader& reader,
+				std::unordered_map< std::string, uint8_t* >& outElements )
+			{
+				uint64 removedAmount = 0u;
+				if ( !reader.ReadValue( removedAmount ) || removedAmount > reader.GetRemainingSize() / sizeof( uint64 ) )
+				{
+					return false;
+				}
+
+				std::unordered_map< std::string, size_t > indices;
+				size_t index = 0u;
+				type.VisitElements( address, [ & ]( const void* element )
+					{
+						std::string key = getKey( static_cast< const uint8_t* >( element ) );
+						outElements.emplace( key, static_cast< uint8_t* >( const_cast< void* >( element ) ) );
+						indices.emplace( std::move( key ), index++ );
+						return VisitOutcome::Continue;
+					} );
+
+				std::vector< size_t > removedIndices;
+				std::string key;
+				for ( uint64 i = 0u; i < removedAmount; ++i )
+				{
+					if ( !ReadBytes( key, reader ) )
+					{
+						return false;
+					}
+
+					auto found = indices.find( key );
+					if ( found == indices.end() )
+					{
+						return false;
+					}
+
+					removedIndices.push_back( found->second );
+					outElements.erase( key );
+				}
+
+				// Removing an element doesn't change the order of the remaining ones.
+				std::sort( removedIndices.begin(), removedIndices.end(), std::greater< size_t >() );
+				for ( size_t removedIndex : removedIndices )
+				{
+					type.RemoveElementAtIndex( address, removedIndex );
+				}
+
+				return true;
+			}
+
+			static bool ReadSetPatch( uint8_t* address, const DynamicContainerType& type, BinaryStreamReader& reader )
+			{
+				const Type& elementType = type.GetInternalTypeDesc().GetType();
+				std::unordered_map< std::string, uint8_t* > elements;
+				if ( !RemoveElements( address, type, [ & ]( const uint8_t* element ) { return Serialize( element, elementType ); }, reader, elements ) )
+				{
+					return false;
+				}
+
+				uint64 addedAmount = 0u;
+				if ( !reader.ReadValue( addedAmount ) || addedAmount > reader.GetRemainingSize() / sizeof( uint64 ) )
+				{
+					return false;
+				}
+
+				ElementBuffer element( elementType );
+				std::string bytes;
+				for ( uint64 i = 0u; i < addedAmount; ++i )
+				{
+					if ( !ReadBytes( bytes, reader ) )
+					{
+						return false;
+					}
+
+					elementType.ConstructInPlace( element.Get() );
+					const bool result = BinarySerializer::Load( element.Get(), elementType, reinterpret_cast< const uint8_t* >( bytes.data() ), bytes.size() );
+					if ( result )
+					{
+						type.EmplaceElement( address, element.Get() );
+					}
+
+					elementType.Destroy( element.Get() );
+					if ( !result )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool ReadMapPatch( uint8_t* address, const DynamicContainerType& type, BinaryStreamReader& reader )
+			{
+				const Type& pairType = type.GetInternalTypeDesc().GetType();
+				const Property& keyProperty = *pairType.GetProperty( 0u );
+				const Property& valueProperty = *pairType.GetProperty( 1u );
+
+				std::unordered_map< std::string, uint8_t* > pairs;
+				if ( !RemoveElements( address, type, [ & ]( const uint8_t* pair ) { return Serialize( pair + keyProperty.GetOffset(), keyProperty.GetType() ); }, reader, pairs ) )
+				{
+					return false;
+				}
+
+				uint64 changedAmount = 0u;
+				if ( !reader.ReadValue( changedAmount ) || changedAmount > reader.GetRemainingSize() / sizeof( uint64 ) )
+				{
+					return false;
+				}
+
+				ElementBuffer pair( pairType );
+				std::string key;
+				for ( uint64 i = 0u; i < changedAmount; ++i )
+				{
+					Mode mode = Mode::Patch;
+					if ( !ReadBytes( key, reader ) || !reader.ReadValue( mode ) )
+					{
+						return false;
+					}
+
+					if ( mode == Mode::Patch )
+					{
+						auto found = pairs.find( key );
+						if ( found == pairs.end() || !ReadPatch( found->second + valueProperty.GetOffset(), valueProperty.GetType(), reader ) )
+						{
+							return false;
+						}
+
+						continue;
+					}
+
+					if ( mode != Mode::Full )
+					{
+						return false;
+					}
+
+					pairType.ConstructInPlace( pair.Get() );
+					uint8_t* pairBytes = static_cast< uint8_t* >( pair.Get() );
+					const bool result = BinarySerializer::Load( pairBytes + keyProperty.GetOffset(), keyProperty.GetType(), reinterpret_cast< const uint8_t* >( key.data() ), key.size() )
+						&& LoadFull( pairBytes + valueProperty.GetOffset(), valueProperty.GetType(), reader );
+					if ( result )
+					{
+						type.EmplaceElement( address, pair.Get() );
+					}
+
+					pairType.Destroy( pair.Get() );
+					if ( !result )
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool ReadPointerPatch( uint8_t* address, void* pointee, const Type& type, const Type& internalType, BinaryStreamReader& reader )
+			{
+				Mode mode = Mode::Patch;
+				if ( !reader.ReadValue( mode ) )
+				{
+					return false;
+				}
+
+				if ( mode == Mode::Full )
+				{
+					return LoadFull( address, type, reader );
+				}
+
+				ID trueTypeId = 0u;
+				if ( mode != Mode::Patch || !reader.ReadValue( trueTypeId ) || !pointee )
+				{
+					return false;
+				}
+
+				const Type& trueType = internalType.GetTrueType( pointee );
+				return trueType.GetID() == trueTypeId && ReadPatch( static_cast< uint8_t* >( pointee ), trueType, reader );
+			}
+		};
+	}
+
+	// Writes a patch that turns the old object into the new one and returns true if they differ, the patch is empty otherwise.
+	// Raw pointers are ignored, like in BinarySerializer.
+	inline bool Diff( const void* oldAddress, const void* newAddress, const Type& type, std::vector< uint8_t >& outPatch )
+	{
+		return internal::Delta::Diff( oldAddress, newAddress, type, outPatch );
+	}
+
+	template< class T >
+	bool Diff( const T& oldObject, const T& newObject, std::vector< uint8_t >& outPatch )
+	{
+		return Diff( &oldObject, &newObject, GetTypeInstanceOf< T >(), outPatch );
+	}
+
+	// Object has to be equal to the old object passed to Diff. Returns false if the patch doesn't match it or is corrupted.
+	inline bool ApplyPatch( void* address, const Type& type, const uint8_t* data, size_t size )
+	{
+		return internal::Delta::ApplyPatch( address, type, data, size );
+	}
+
+	template< class T >
+	bool ApplyPatch( T& object, const std::vector< uint8_t >& patch )
+	{
+		return ApplyPatch( &object, GetTypeInstanceOf< T >(), patch.data(), patch.size() );
+	}
+}
+#pragma endregion
+
+#pragma region ChangeTracking
+#if RTTI_CFG_CHANGE_TRACKING
+namespace rtti
+{
+	// Dirty bits of tracked instances, indexed like Type::GetProperty. Properties are marked by Property::SetValue, by mutators of containers
+	// stored directly in the instance or in its struct members, and by calls of non const reflected methods on the instance or its struct members.
+	// Elements of containers and pointees aren't tracked, changes of them have to be marked with MarkDirty.
+	// Hooks check a lock-free filter of tracked addresses first, so code touching untracked objects doesn't take the mutex.
+	class ChangeTracker
+	{
+	public:
+		static ChangeTracker& Get()
+		{
+			static ChangeTracker s_instance;
+			return s_instance;
+		}
+
+		// Starts tracking with all properties clean.
+		void Track( void* address, const Type& type )
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			if ( m_instances.contains( address ) )
+			{
+				UntrackInternal( address );
+			}
+
+			Instance& instance = m_instances[ address ];
+			instance.m_type = &type;
+			instance.m_dirtyBits.assign( ( type.GetPropertiesAmount() + 63u ) / 64u, 0u );
+			AddToFilter( address );
+
+			for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+			{
+				const Property* property = type.GetProperty( i );
+				TrackMember( instance, address, static_cast< uint8_t* >( property->GetAddress( address ) ), property->GetType(), i );
+			}
+		}
+
+		template< class T >
+		void Track( T& object )
+		{
+			Track( &object, GetTypeInstanceOf< T >().GetTrueType( &object ) );
+		}
+
+		void Untrack( const void* address )
+		{
+			if ( !MightBeTracked( address ) )
+			{
+				return;
+			}
+
+			std::lock_guard< std::mutex > lock( m_mutex );
+			UntrackInternal( address );
+		}
+
+		bool IsTracked( const void* address ) const
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			return m_instances.contains( address );
+		}
+
+		// Address might be a tracked instance or one of its struct members.
+		void MarkDirty( const void* address, const Property& property )
+		{
+			if ( !MightBeTracked( address ) )
+			{
+				return;
+			}
+
+			std::lock_guard< std::mutex > lock( m_mutex );
+			if ( Instance* instance = FindInstance( address ) )
+			{
+				const auto& indices = GetPropertyIndices( *instance->m_type );
+				auto found = indices.find( &property );
+				if ( found != indices.end() && found->second < instance->m_dirtyBits.size() * 64u )
+				{
+					SetDirtyBit( *instance, found->second );
+					return;
+				}
+			}
+
+			MarkMemberDirty( address );
+		}
+
+		void MarkDirty( const void* address, size_t propertyIndex )
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			Instance* instance = FindInstance( address );
+			if ( instance && propertyIndex < instance->m_type->GetPropertiesAmount() )
+			{
+				SetDirtyBit( *instance, propertyIndex );
+			}
+		}
+
+		// Marks all properties of a tracked instance, or the property holding a tracked struct member.
+		void MarkAllDirty( const void* address )
+		{
+			if ( !MightBeTracked( address ) )
+			{
+				return;
+			}
+
+			std::lock_guard< std::mutex > lock( m_mutex );
+			if ( Instance* instance = FindInstance( address ) )
+			{
+				for ( size_t i = 0u; i < instance->m_type->GetPropertiesAmount(); ++i )
+				{
+					SetDirtyBit( *instance, i );
+				}
+			}
+			else
+			{
+				MarkMemberDirty( address );
+			}
+		}
+
+		void MarkContainerDirty( const void* containerAddress )
+		{
+			if ( !MightBeTracked( containerAddress ) )
+			{
+				return;
+			}
+
+			std::lock_guard< std::mutex > lock( m_mutex );
+			MarkMemberDirty( containerAddress );
+		}
+
+		bool IsDirty( const void* address ) const
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			const Instance* instance = FindInstance( address );
+			return instance && std::any_of( instance->m_dirtyBits.begin(), instance->m_dirtyBits.end(), []( uint64 bits ) { return bits != 0u; } );
+		}
+
+		bool IsDirty( const void* address, size_t propertyIndex ) const
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			const Instance* instance = FindInstance( address );
+			return instance && propertyIndex < instance->m_type->GetPropertiesAmount() && ( instance->m_dirtyBits[ propertyIndex / 64u ] & ( 1ull << ( propertyIndex % 64u ) ) ) != 0u;
+		}
+
+		// Visits dirty properties in the order of their indices. Tracker might be used inside visitFunc.
+		void VisitDirtyProperties( const void* address, const std::function< VisitOutcome( const Property&, size_t ) >& visitFunc ) const
+		{
+			const Type* type = nullptr;
+			std::vector< uint64 > dirtyBits;
+			{
+				std::lock_guard< std::mutex > lock( m_mutex );
+				const Instance* instance = FindInstance( address );
+				if ( !instance )
+				{
+					return;
+				}
+
+				type = instance->m_type;
+				dirtyBits = instance->m_dirtyBits;
+			}
+
+			for ( size_t word = 0u; word < dirtyBits.size(); ++word )
+			{
+				for ( uint64 bits = dirtyBits[ word ]; bits != 0u; bits &= bits - 1u )
+				{
+					const size_t index = word * 64u + std::countr_zero( bits );
+					if ( visitFunc( *type->GetProperty( index ), index ) == VisitOutcome::Break )
+					{
+						return;
+					}
+				}
+			}
+		}
+
+		void ClearDirty( const void* address )
+		{
+			std::lock_guard< std::mutex > lock( m_mutex );
+			if ( Instance* instance = FindInstance( address ) )
+			{
+				std::fill( instance->m_dirtyBits.begin(), instance->m_dirtyBits.end(), 0u );
+			}
+		}
+
+	private:
+		struct Instance
+		{
+			const Type* m_type = nullptr;
+			std::vector< uint64 > m_dirtyBits;
+			std::vector< const void* > m_members;
+		};
+
+		struct PropertyIndices
+		{
+			uint64 m_runtimeLayoutsVersion = 0u;
+			std::unordered_map< const Property*, size_t > m_indices;
+		};
+
+		struct MemberOwner
+		{
+			const void* m_owner = nullptr;
+			size_t m_propertyIndex = 0u;
+		};
+
+		static constexpr size_t c_filterBucketsAmount = 4096u;
+
+		ChangeTracker() = default;
+
+		static size_t GetFilterBucket( const void* address )
+		{
+			return ( reinterpret_cast< uintptr_t >( address ) >> 3u ) % c_filterBucketsAmount;
+		}
+
+		bool MightBeTracked( const void* address ) const
+		{
+			return m_filter[ GetFilterBucket( address ) ].load( std::memory_order_relaxed ) != 0u;
+		}
+
+		void AddToFilter( const void* address )
+		{
+			m_filter[ GetFilterBucket( address ) ].fetch_add( 1u, std::memory_order_relaxed );
+		}
+
+		void RemoveFromFilter( const void* address )
+		{
+			m_filter[ GetFilterBucket( address ) ].fetch_sub( 1u, std::memory_order_relaxed );
+		}
+
+		Instance* FindInstance( const void* address )
+		{
+			auto found = m_instances.find( address );
+			return found != m_instances.end() ? &found->second : nullptr;
+		}
+
+		const Instance* FindInstance( const void* address ) const
+		{
+			auto found = m_instances.find( address );
+			return found != m_instances.end() ? &found->second : nullptr;
+		}
+
+		// Runtime types might change their properties after instances were tracked, so their indices are rebuilt then.
+		const std::unordered_map< const Property*, size_t >& GetPropertyIndices( const Type& type )
+		{
+			PropertyIndices& indices = m_propertyIndices[ &type ];
+			const uint64 runtimeLayoutsVersion = internal::GetRuntimeLayoutsVersion().load( std::memory_order_acquire );
+			if ( indices.m_indices.empty() || ( type.GetKind() == Type::Kind::RuntimeType && indices.m_runtimeLayoutsVersion != runtimeLayoutsVersion ) )
+			{
+				indices.m_indices.clear();
+				indices.m_runtimeLayoutsVersion = runtimeLayoutsVersion;
+				for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+				{
+					indices.m_indices.emplace( type.GetProperty( i ), i );
+				}
+			}
+
+			return indices.m_indices;
+		}
+
+		static void SetDirtyBit( Instance& instance, size_t index )
+		{
+			instance.m_dirtyBits[ index / 64u ] |= 1ull << ( index % 64u );
+		}
+
+		// Maps containers and struct members, at any depth, to the index of the property of the tracked instance holding them.
+		void TrackMember( Instance& instance, const void* owner, uint8_t* address, const Type& type, size_t propertyIndex )
+		{
+			const Type::Kind kind = type.GetKind();
+			const bool isContainer = kind == Type::Kind::Vector || kind == Type::Kind::Set || kind == Type::Kind::Map;
+			const bool isClassLike = kind == Type::Kind::Class || kind == Type::Kind::Struct || kind == Type::Kind::RuntimeType;
+			if ( !isContainer && !isClassLike )
+			{
+				return;
+			}
+
+			if ( m_members.emplace( address, MemberOwner{ owner, propertyIndex } ).second )
+			{
+				instance.m_members.push_back( address );
+				AddToFilter( address );
+			}
+
+			if ( isClassLike )
+			{
+				for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+				{
+					const Property* property = type.GetProperty( i );
+					TrackMember( instance, owner, static_cast< uint8_t* >( property->GetAddress( address ) ), property->GetType(), propertyIndex );
+				}
+			}
+		}
+
+		void MarkMemberDirty( const void* address )
+		{
+			auto found = m_members.find( address );
+			if ( found != m_members.end() )
+			{
+				SetDirtyBit( *FindInstance( found->second.m_owner ), found->second.m_propertyIndex );
+			}
+		}
+
+		void UntrackInternal( const void* address )
+		{
+			auto found = m_instances.find( address );
+			if ( found == m_instances.end() )
+			{
+				return;
+			}
+
+			for ( const void* member : found->second.m_members )
+			{
+				m_members.erase( member );
+				RemoveFromFilter( member );
+			}
+
+			m_instances.erase( found );
+			RemoveFromFilter( address );
+		}
+
+		mutable std::mutex m_mutex;
+		std::array< std::atomic< uint32_t >, c_filterBucketsAmount > m_filter = {};
+		std::unordered_map< const void*, Instance > m_instances;
+		std::unordered_map< const void*, MemberOwner > m_members;
+		std::unordered_map< const Type*, PropertyIndices > m_propertyIndices;
+	};
+
+	// Tracks an object for the lifetime of the scope, so no entry outlives the object.
+	class ScopedChangeTracking
+	{
+	public:
+		template< class T >
+		explicit ScopedChangeTracking( T& object )
+			: m_address( &object )
+		{
+			ChangeTracker::Get().Track( object );
+		}
+
+		ScopedChangeTracking( const ScopedChangeTracking& ) = delete;
+		ScopedChangeTracking& operator=( const ScopedChangeTracking& ) = delete;
+
+		~ScopedChangeTracking()
+		{
+			ChangeTracker::Get().Untrack( m_address );
+		}
+
+	private:
+		const void* m_address = nullptr;
+	};
+
+	namespace internal
+	{
+		inline void OnPropertyChanged( void* owner, const Property& property )
+		{
+			ChangeTracker::Get().MarkDirty( owner, property );
+		}
+
+		inline void OnObjectChanged( void* address )
+		{
+			ChangeTracker::Get().MarkAllDirty( address );
+		}
+
+		inline void OnContainerChanged( void* containerAddress )
+		{
+			ChangeTracker::Get().MarkContainerDirty( containerAddress );
+		}
+
+		inline void OnObjectDestroyed( void* address )
+		{
+			ChangeTracker::Get().Untrack( address );
+		}
+	}
+}
+#endif
+#pragma endregion
+
+#pragma region StaticProperties
+namespace rtti
+{
+	// Specialized by RTTI_STATIC_PROPERTIES with constexpr Get() returning a tuple of internal::StaticProperty.
+	template< class T >
+	struct StaticProperties;
+
+	namespace internal
+	{
+		template< class TClass, class TMember >
+		struct StaticProperty
+		{
+			using ClassType = TClass;
+			using MemberType = TMember;
+
+			const char* m_name = nullptr;
+			ID m_id = 0u;
+			TMember TClass::* m_member = nullptr;
+			size_t m_offset = 0u;
+			void ( *m_initFunc )( Property& ) = nullptr;
+		};
+
+		template< class TClass, class TMember >
+		constexpr StaticProperty< TClass, TMember > MakeStaticProperty( const char* name, TMember TClass::* member, size_t offset, void ( *initFunc )( Property& ) )
+		{
+			return { name, CalcHash( name ), member, offset, initFunc };
+		}
+
+		template< class TFunc, class... TArgs >
+		constexpr bool InvokeStaticVisitor( TFunc& func, TArgs&&... args )
+		{
+			if constexpr ( std::is_void_v< std::invoke_result_t< TFunc&, TArgs... > > )
+			{
+				func( std::forward< TArgs >( args )... );
+				return true;
+			}
+			else
+			{
+				return func( std::forward< TArgs >( args )... ) == VisitOutcome::Continue;
+			}
+		}
+
+		template< class T, class TFunc >
+		constexpr bool StaticVisitPropertyDescs( TFunc& func );
+
+		template< class T, class TObject, class TFunc >
+		constexpr bool StaticVisitPropertiesOf( TObject& object, TFunc& func );
+	}
+
+	template< class T >
+	constexpr bool HasStaticProperties()
+	{
+		return requires { StaticProperties< std::remove_const_t< T > >::Get(); };
+	}
+
+	namespace internal
+	{
+		template< class T >
+		constexpr bool HasStaticParent()
+		{
+			if constexpr ( requires { typename T::Super; } )
+			{
+				return HasStaticProperties< typename T::Super >();
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// Parent's properties go first, like in Type::GetProperty.
+		template< class T, class TFunc >
+		constexpr bool StaticVisitPropertyDescs( TFunc& func )
+		{
+			if constexpr ( HasStaticParent< T >() )
+			{
+				if ( !StaticVisitPropertyDescs< typename T::Super >( func ) )
+				{
+					return false;
+				}
+			}
+
+			return std::apply( [ & ]( const auto&... properties ) { return ( InvokeStaticVisitor( func, properties ) && ... ); }, StaticProperties< T >::Get() );
+		}
+
+		template< class T, class TObject, class TFunc >
+		constexpr bool StaticVisitPropertiesOf( TObject& object, TFunc& func )
+		{
+			auto visitDesc = [ & ]( const auto& property )
+				{
+					return InvokeStaticVisitor( func, property.m_name, object.*property.m_member ) ? VisitOutcome::Continue : VisitOutcome::Break;
+				};
+			return StaticVisitPropertyDescs< T >( visitDesc );
+		}
+	}
+
+	// Calls func( const char* name, member ) for every property declared with RTTI_STATIC_PROPERTIES, func might return VisitOutcome to stop.
+	// Members are accessed directly, so the whole visitation might be inlined or evaluated at compile time.
+	template< class T, class TFunc >
+	constexpr void StaticVisitProperties( T& object, TFunc&& func )
+	{
+		static_assert( HasStaticProperties< T >(), "Type has no static properties, declare them with RTTI_STATIC_PROPERTIES." );
+		internal::StaticVisitPropertiesOf< std::remove_const_t< T > >( object, func );
+	}
+
+	template< class T >
+	constexpr size_t GetStaticPropertiesAmount()
+	{
+		size_t amount = 0u;
+		auto count = [ & ]( const auto& ) { ++amount; };
+		internal::StaticVisitPropertyDescs< T >( count );
+		return amount;
+	}
+
+	namespace internal
+	{
+		// Own properties of T declared with RTTI_STATIC_PROPERTIES, constant initialized in static storage.
+		// Registration only links types of the properties and adds their metadata.
+		template< class T, size_t... Indices >
+		class StaticPropertiesTable< T, std::index_sequence< Indices... > >
+		{
+		public:
+			static std::span< Property > Link()
+			{
+				( LinkProperty< Indices >(), ... );
+				return GetProperties();
+			}
+
+			static std::span< Property > GetProperties()
+			{
+				return s_storage.m_properties;
+			}
+
+		private:
+			static constexpr auto c_descs = StaticProperties< T >::Get();
+
+			template< size_t Index >
+			static void LinkProperty()
+			{
+				using MemberType = typename std::tuple_element_t< Index, decltype( c_descs ) >::MemberType;
+				static_assert( !std::is_reference_v< MemberType >, "Reference properties are not supported!" );
+				static_assert( !std::is_const_v< MemberType >, "Const properties are not supported!" );
+
+				Property& property = s_storage.m_properties[ Index ];
+				property.m_type = &GetTypeInstanceOf< MemberType >();
+				std::get< Index >( c_descs ).m_initFunc( property );
+			}
+
+			// Never destroyed, like type objects in StaticTypeStorage.
+			union Storage
+			{
+				Property m_properties[ sizeof...( Indices ) ];
+				constexpr ~Storage() {}
+			};
+
+			// Descriptors are read from a constexpr variable, so every element is initialized with constants.
+			static constinit inline Storage s_storage = { { { std::get< Indices >( c_descs ).m_name, std::get< Indices >( c_descs ).m_id, std::get< Indices >( c_descs ).m_offset,
+				GetInstanceFlags< typename std::tuple_element_t< Indices, decltype( c_descs ) >::MemberType >() }... } };
+		};
+
+		template< class T >
+		class StaticPropertiesTable< T, std::index_sequence<> >
+		{
+		public:
+			static std::span< Property > Link()
+			{
+				return {};
+			}
+
+			static std::span< Property > GetProperties()
+			{
+				return {};
+			}
+		};
+
+		template< class T >
+		using StaticPropertiesTableOf = StaticPropertiesTable< T, std::make_index_sequence< std::tuple_size_v< decltype( StaticProperties< T >::Get() ) > > >;
+
+		// Tables hold only own properties, so static properties of parents have to be registered by the parents and own ones can't be inherited.
+		template< class T >
+		bool CanLinkStaticProperties( const Type* parentType )
+		{
+			bool canLink = true;
+			auto isInherited = [ & ]( const auto& property ) { return parentType && parentType->FindProperty( property.m_id ); };
+			if constexpr ( HasStaticParent< T >() )
+			{
+				auto checkParentProperty = [ & ]( const auto& property ) { canLink = canLink && isInherited( property ); };
+				StaticVisitPropertyDescs< typename T::Super >( checkParentProperty );
+			}
+
+			std::apply( [ & ]( const auto&... properties ) { canLink = canLink && !( isInherited( properties ) || ... ); }, StaticProperties< T >::Get() );
+			return canLink;
+		}
+	}
+}
+
+// Metadata might be added like in RTTI_REGISTER_PROPERTY, e.g. RTTI_STATIC_PROPERTY( m_a, TryToAddMetadata( "Key", "Value" ); ).
+#define RTTI_STATIC_PROPERTY( PropertyName, ... ) ::rtti::internal::MakeStaticProperty( #PropertyName, &CurrentlyImplementedType::PropertyName, offsetof( CurrentlyImplementedType, PropertyName ), \
+	RTTI_INTERNAL_PROPERTY_INIT_FUNC( __VA_ARGS__ ) )
+
+// Has to be used in the global namespace, e.g. RTTI_STATIC_PROPERTIES( ns::Foo, RTTI_STATIC_PROPERTY( m_a ), RTTI_STATIC_PROPERTY( m_b ) ).
+#define RTTI_STATIC_PROPERTIES( NamespaceClassName, ... ) \
+template<> \
+struct rtti::StaticProperties< NamespaceClassName > \
+{ \
+	using CurrentlyImplementedType = NamespaceClassName; \
+	static constexpr auto Get() \
+	{ \
+		return std::make_tuple( __VA_ARGS__ ); \
+	} \
+};
+
+// Registers runtime properties from the static ones, so they are listed only once. Might be used inside RTTI_IMPLEMENT_TYPE.
+// Used before any other property, it links the constant initialized table of own properties instead of creating them.
+#define RTTI_REGISTER_STATIC_PROPERTIES() \
+{ \
+	if ( m_properties.empty() && m_linkedProperties.empty() && ::rtti::internal::CanLinkStaticProperties< CurrentlyImplementedType >( ::rtti::internal::TryToGetInstance< ParentClassType >() ) ) \
+	{ \
+		m_linkedProperties = ::rtti::internal::StaticPropertiesTableOf< CurrentlyImplementedType >::Link(); \
+	} \
+	else \
+	{ \
+		auto registerProperty = [ & ]( const auto& property ) \
+		{ \
+			using MemberType = typename std::remove_cvref_t< decltype( property ) >::MemberType; \
+			TryToAddProperty( CreateProperty< MemberType >( property.m_name, static_cast< size_t >( -1 ), property.m_offset ), property.m_initFunc ); \
+		}; \
+		m_properties.reserve( m_properties.size() + std::tuple_size_v< decltype( ::rtti::StaticProperties< CurrentlyImplementedType >::Get() ) > ); \
+		::rtti::internal::StaticVisitPropertyDescs< CurrentlyImplementedType >( registerProperty ); \
+	} \
+}
 #pragma endregion
\ No newline at end of file
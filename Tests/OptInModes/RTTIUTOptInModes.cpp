@@ -0,0 +1,379 @@
+// Optional modes change the layout of library types, so they are tested in their own executable next to the default configuration one.
+#define RTTI_CFG_CHANGE_TRACKING 1
+#define RTTI_CFG_GUARD_FREE_INSTANCES 1
+#define RTTI_CFG_LAZY_TYPE_REGISTRATION 1
+#define RTTI_CFG_REGISTRATION_PROFILER 1
+#include "gtest/gtest.h"
+#include "../../LibeRTTI.h"
+#include <thread>
+
+#define TestCaseName RTTIOptInModes
+
+typedef float Float;
+typedef __int32 Int32;
+typedef unsigned Uint32;
+
+namespace rttiTest
+{
+	struct TrackedNested
+	{
+		RTTI_DECLARE_STRUCT( TrackedNested );
+
+		void Clear() { m_values.clear(); }
+
+		Int32 m_value = 0;
+		std::vector< Int32 > m_values;
+	};
+
+	struct TrackedStruct
+	{
+		RTTI_DECLARE_STRUCT( TrackedStruct );
+
+		Int32 GetValue() const { return m_value; }
+		void Reset() { m_value = 0; m_values.clear(); }
+
+		Int32 m_value = 0;
+		std::string m_name;
+		std::vector< Int32 > m_values;
+		TrackedNested m_nested;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::TrackedNested,
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_PROPERTY( m_values );
+	RTTI_REGISTER_METHOD( Clear );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::TrackedStruct,
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_PROPERTY( m_name );
+	RTTI_REGISTER_PROPERTY( m_values );
+	RTTI_REGISTER_PROPERTY( m_nested );
+	RTTI_REGISTER_METHOD( GetValue );
+	RTTI_REGISTER_METHOD( Reset );
+);
+
+TEST( TestCaseName, ChangeTracking )
+{
+	const auto& type = rttiTest::TrackedStruct::GetTypeStatic();
+	::rtti::ChangeTracker& tracker = ::rtti::ChangeTracker::Get();
+	rttiTest::TrackedStruct obj;
+	rttiTest::TrackedStruct untracked;
+	tracker.Track( obj );
+	EXPECT_FALSE( tracker.IsDirty( &obj ) );
+
+	type.FindProperty( "m_name" )->SetValue( &obj, std::string( "Name" ) );
+	type.FindProperty( "m_name" )->SetValue( &untracked, std::string( "Name" ) );
+	EXPECT_TRUE( tracker.IsDirty( &obj, 1u ) );
+	EXPECT_FALSE( tracker.IsDirty( &obj, 0u ) );
+	EXPECT_FALSE( tracker.IsDirty( &untracked ) );
+
+	const auto* valuesProperty = type.FindProperty( "m_values" );
+	static_cast< const ::rtti::DynamicContainerType& >( valuesProperty->GetType() ).AddDefaultElement( valuesProperty->GetAddress( &obj ) );
+	std::vector< size_t > dirtyIndices;
+	tracker.VisitDirtyProperties( &obj, [ & ]( const ::rtti::Property& property, size_t index )
+		{
+			EXPECT_EQ( &property, type.GetProperty( index ) );
+			dirtyIndices.push_back( index );
+			return ::rtti::VisitOutcome::Continue;
+		} );
+	EXPECT_EQ( dirtyIndices, std::vector< size_t >( { 1u, 2u } ) );
+
+	tracker.ClearDirty( &obj );
+	Int32 value = 0;
+	type.FindMethod( "GetValue" )->Call( &obj, nullptr, &value );
+	EXPECT_FALSE( tracker.IsDirty( &obj ) );
+	type.FindMethod( "Reset" )->Call( &obj, nullptr, nullptr );
+	EXPECT_TRUE( tracker.IsDirty( &obj, 0u ) && tracker.IsDirty( &obj, 1u ) && tracker.IsDirty( &obj, 2u ) );
+
+	tracker.Untrack( &obj );
+	EXPECT_FALSE( tracker.IsTracked( &obj ) );
+	EXPECT_FALSE( tracker.IsDirty( &obj ) );
+}
+
+TEST( TestCaseName, ChangeTrackingOfStructMembers )
+{
+	const auto& type = rttiTest::TrackedStruct::GetTypeStatic();
+	const auto& nestedType = rttiTest::TrackedNested::GetTypeStatic();
+	::rtti::ChangeTracker& tracker = ::rtti::ChangeTracker::Get();
+	rttiTest::TrackedStruct obj;
+	::rtti::ScopedChangeTracking tracking( obj );
+
+	nestedType.FindProperty( "m_value" )->SetValue( &obj.m_nested, 5 );
+	EXPECT_TRUE( tracker.IsDirty( &obj, 3u ) );
+	EXPECT_FALSE( tracker.IsDirty( &obj, 0u ) );
+
+	tracker.ClearDirty( &obj );
+	const auto* valuesProperty = nestedType.FindProperty( "m_values" );
+	static_cast< const ::rtti::DynamicContainerType& >( valuesProperty->GetType() ).AddDefaultElement( &obj.m_nested.m_values );
+	EXPECT_TRUE( tracker.IsDirty( &obj, 3u ) );
+	EXPECT_FALSE( tracker.IsDirty( &obj, 2u ) );
+
+	tracker.ClearDirty( &obj );
+	nestedType.FindMethod( "Clear" )->Call( &obj.m_nested, nullptr, nullptr );
+	std::vector< size_t > dirtyIndices;
+	tracker.VisitDirtyProperties( &obj, [ & ]( const ::rtti::Property&, size_t index )
+		{
+			dirtyIndices.push_back( index );
+			return ::rtti::VisitOutcome::Continue;
+		} );
+	EXPECT_EQ( dirtyIndices, std::vector< size_t >( { 3u } ) );
+}
+
+TEST( TestCaseName, ChangeTrackingOfDestroyedObjects )
+{
+	const auto& type = rttiTest::TrackedStruct::GetTypeStatic();
+	::rtti::ChangeTracker& tracker = ::rtti::ChangeTracker::Get();
+	alignas( rttiTest::TrackedStruct ) uint8_t memory[ sizeof( rttiTest::TrackedStruct ) ];
+
+	type.ConstructInPlace( memory );
+	tracker.Track( memory, type );
+	EXPECT_TRUE( tracker.IsTracked( memory ) );
+	type.Destroy( memory );
+	EXPECT_FALSE( tracker.IsTracked( memory ) );
+
+	// Nothing of the destroyed object is tracked anymore, so a new object in its place starts untracked.
+	type.ConstructInPlace( memory );
+	auto* obj = reinterpret_cast< rttiTest::TrackedStruct* >( memory );
+	static_cast< const ::rtti::DynamicContainerType& >( type.FindProperty( "m_values" )->GetType() ).AddDefaultElement( &obj->m_values );
+	EXPECT_FALSE( tracker.IsDirty( memory ) );
+	type.Destroy( memory );
+
+	const void* scopedAddress = nullptr;
+	{
+		rttiTest::TrackedStruct scoped;
+		::rtti::ScopedChangeTracking tracking( scoped );
+		scopedAddress = &scoped;
+		EXPECT_TRUE( tracker.IsTracked( scopedAddress ) );
+	}
+	EXPECT_FALSE( tracker.IsTracked( scopedAddress ) );
+}
+
+TEST( TestCaseName, ChangeTrackingOfRuntimeTypes )
+{
+	auto& parentType = ::rtti::RuntimeType<>::Create( "ChangeTrackingRuntimeParent" );
+	parentType.AddProperty< Int32 >( "m_first" );
+	auto& type = ::rtti::RuntimeType< ::rtti::RuntimeType<> >::Create( "ChangeTrackingRuntimeDerived", parentType );
+	type.AddProperty< Int32 >( "m_own" );
+	::rtti::ChangeTracker& tracker = ::rtti::ChangeTracker::Get();
+	alignas( 16 ) uint8_t memory[ 64 ];
+
+	type.ConstructInPlace( memory );
+	tracker.Track( memory, type );
+	type.FindProperty( "m_own" )->SetValue( memory, 1 );
+	EXPECT_TRUE( tracker.IsDirty( memory, 1u ) );
+	type.Destroy( memory );
+
+	// The derived property keeps its address but moves to a new index.
+	parentType.AddProperty< Int32 >( "m_second" );
+	ASSERT_LE( type.GetSize(), sizeof( memory ) );
+	type.ConstructInPlace( memory );
+	tracker.Track( memory, type );
+	type.FindProperty( "m_own" )->SetValue( memory, 2 );
+	EXPECT_TRUE( tracker.IsDirty( memory, 2u ) );
+	EXPECT_FALSE( tracker.IsDirty( memory, 1u ) );
+	type.Destroy( memory );
+}
+
+namespace rttiTest
+{
+	class GuardFreeBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( GuardFreeBase );
+
+	public:
+		virtual ~GuardFreeBase() = default;
+	};
+
+	class GuardFreeDerived : public GuardFreeBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( GuardFreeDerived, GuardFreeBase );
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::GuardFreeBase );
+RTTI_IMPLEMENT_TYPE( rttiTest::GuardFreeDerived );
+
+TEST( TestCaseName, GuardFreeInstances )
+{
+	const auto& type = ::rtti::GetTypeInstanceOf< std::vector< std::unique_ptr< rttiTest::GuardFreeDerived > > >();
+	EXPECT_EQ( ::rtti::internal::TypeInstanceSlot< std::remove_cvref_t< decltype( type ) > >::s_instance.load(), &type );
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( type.GetID() ), &type );
+	EXPECT_EQ( &rttiTest::GuardFreeDerived::GetTypeStatic(), ::rtti::RTTI::Get().FindType( "rttiTest::GuardFreeDerived" ) );
+	EXPECT_EQ( ::rtti::internal::TypeInstanceSlot< rttiTest::GuardFreeDerived::Type >::s_instance.load(), &rttiTest::GuardFreeDerived::GetTypeStatic() );
+}
+
+TEST( TestCaseName, GuardFreeConcurrentFirstAccess )
+{
+	using PointersVector = std::vector< rttiTest::GuardFreeDerived** >;
+	EXPECT_EQ( ::rtti::internal::TypeInstanceSlot< std::remove_cvref_t< decltype( ::rtti::GetTypeInstanceOf< PointersVector >() ) > >::s_instance.load(), nullptr );
+	const size_t typesAmount = ::rtti::RTTI::Get().GetTypes().size();
+
+	std::atomic< bool > start = false;
+	std::vector< const ::rtti::Type* > results( 8u, nullptr );
+	std::vector< std::thread > threads;
+	for ( size_t i = 0u; i < results.size(); ++i )
+	{
+		threads.emplace_back( [ &, i ]()
+		{
+			while ( !start.load() )
+			{
+				std::this_thread::yield();
+			}
+
+			results[ i ] = &::rtti::GetTypeInstanceOf< PointersVector >();
+		} );
+	}
+
+	start = true;
+	for ( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+
+	for ( const ::rtti::Type* result : results )
+	{
+		EXPECT_EQ( result, results.front() );
+	}
+
+	// The vector, the pointer to pointer and the pointer types.
+	EXPECT_EQ( ::rtti::RTTI::Get().GetTypes().size(), typesAmount + 3u );
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( results.front()->GetID() ), results.front() );
+}
+
+namespace rttiTest
+{
+	std::atomic< Uint32 > g_lazyStructRegistrations = 0u;
+
+	struct LazyStruct
+	{
+		RTTI_DECLARE_STRUCT( LazyStruct );
+
+		Int32 GetValue() const { return m_value; }
+
+		Int32 m_value = 0;
+		Float m_factor = 0.0f;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::LazyStruct,
+	++rttiTest::g_lazyStructRegistrations;
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_PROPERTY( m_factor );
+	RTTI_REGISTER_METHOD( GetValue );
+);
+
+TEST( TestCaseName, LazyMembersRegistration )
+{
+	const auto& type = rttiTest::LazyStruct::GetTypeStatic();
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( "rttiTest::LazyStruct" ), &type );
+	EXPECT_EQ( rttiTest::g_lazyStructRegistrations.load(), 0u );
+
+	std::vector< std::thread > threads;
+	std::atomic< Uint32 > validResults = 0u;
+	for ( Uint32 i = 0u; i < 8u; ++i )
+	{
+		threads.emplace_back( [ & ]()
+		{
+			if ( type.GetPropertiesAmount() == 2u && type.GetMethodsAmount() == 1u && type.FindProperty( "m_factor" ) )
+			{
+				++validResults;
+			}
+		} );
+	}
+
+	for ( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ( validResults.load(), 8u );
+	EXPECT_EQ( rttiTest::g_lazyStructRegistrations.load(), 1u );
+}
+
+namespace rttiTest
+{
+	struct LazyProfiledStruct
+	{
+		RTTI_DECLARE_STRUCT( LazyProfiledStruct );
+
+		Int32 m_value = 0;
+		std::vector< Float > m_factors;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::LazyProfiledStruct,
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_PROPERTY( m_factors );
+);
+
+TEST( TestCaseName, LazyMembersRegistrationProfile )
+{
+	auto& profiler = ::rtti::RegistrationProfiler::Get();
+	const auto countRecords = [ &profiler ]( const char* name, bool isMembersRegistration )
+	{
+		const auto records = profiler.GetRecords();
+		return std::count_if( records.begin(), records.end(), [ & ]( const auto& record ) { return record.m_name == name && record.m_isMembersRegistration == isMembersRegistration; } );
+	};
+
+	const auto& type = rttiTest::LazyProfiledStruct::GetTypeStatic();
+	EXPECT_EQ( countRecords( type.GetName(), false ), 1 );
+	EXPECT_EQ( countRecords( type.GetName(), true ), 0 );
+
+	EXPECT_EQ( type.GetPropertiesAmount(), 2u );
+	EXPECT_EQ( type.GetPropertiesAmount(), 2u );
+	EXPECT_EQ( countRecords( type.GetName(), true ), 1 );
+
+	for ( const auto& record : profiler.GetRecords() )
+	{
+		if ( record.m_isMembersRegistration && record.m_name == type.GetName() )
+		{
+			EXPECT_EQ( record.m_id, type.GetID() );
+			EXPECT_LE( record.m_start, record.m_onRegisteredStart );
+			EXPECT_LE( record.m_onRegisteredStart, record.m_onRegisteredEnd );
+			EXPECT_LE( record.m_onRegisteredEnd, record.m_end );
+		}
+	}
+
+	std::string json;
+	profiler.WriteChromeTrace( json );
+	EXPECT_NE( json.find( "\"name\":\"rttiTest::LazyProfiledStruct\",\"cat\":\"RegisterMembers\"" ), std::string::npos );
+}
+
+namespace rttiTest
+{
+	struct LazyStatsStruct
+	{
+		RTTI_DECLARE_STRUCT( LazyStatsStruct );
+
+		Int32 GetValue() const { return m_value; }
+
+		Int32 m_value = 0;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::LazyStatsStruct,
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_METHOD( GetValue );
+);
+
+TEST( TestCaseName, LazyMembersMemoryStats )
+{
+	const auto& type = rttiTest::LazyStatsStruct::GetTypeStatic();
+	const auto findTypeStats = [ &type ]()
+	{
+		const auto stats = ::rtti::RTTI::Get().GetMemoryStats();
+		auto found = std::find_if( stats.m_perType.begin(), stats.m_perType.end(), [ & ]( const auto& entry ) { return entry.first == &type; } );
+		return found != stats.m_perType.end() ? found->second : ::rtti::TypeMemoryStats();
+	};
+
+	// Collecting stats doesn't register members.
+	EXPECT_EQ( findTypeStats().m_propertiesBytes, 0u );
+	EXPECT_EQ( findTypeStats().m_methodsBytes, 0u );
+
+	ASSERT_EQ( type.GetPropertiesAmount(), 1u );
+	const auto stats = findTypeStats();
+	EXPECT_GE( stats.m_propertiesBytes, sizeof( ::rtti::Property ) );
+	EXPECT_GE( stats.m_methodsBytes, sizeof( ::rtti::Function ) );
+}
\ No newline at end of file
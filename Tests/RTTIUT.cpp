@@ -1296,6 +1296,8 @@ namespace rttiTest
 		Int32 m_prop = 0;
 		Bool m_boolean = false;
 	};
+
+	inline Int32 s_discardedPropertyInitsAmount = 0;
 }
 
 RTTI_IMPLEMENT_TYPE( rttiTest::StructPropertiesWithMetadata,
@@ -1306,6 +1308,10 @@ RTTI_IMPLEMENT_TYPE( rttiTest::StructPropertiesWithMetadata,
 	RTTI_REGISTER_PROPERTY( m_boolean,
 		RTTI_ADD_METADATA( WithValue, 321 );
 	);
+	RTTI_REGISTER_PROPERTY( m_boolean,
+		RTTI_ADD_METADATA( Discarded );
+		++rttiTest::s_discardedPropertyInitsAmount;
+	);
 );
 
 TEST( TestCaseName, PropertyMetadata )
@@ -1327,4 +1333,1362 @@ TEST( TestCaseName, PropertyMetadata )
 		EXPECT_TRUE( value && *value == "321" );
 	}
 	EXPECT_EQ( type.FindProperty( "m_boolean" )->GetMetadataValue( "WithoutValue" ), nullptr );
+
+	// Duplicated registrations are discarded before their metadata is added.
+	EXPECT_EQ( type.GetPropertiesAmount(), 2u );
+	EXPECT_FALSE( type.FindProperty( "m_boolean" )->HasMetadata( "Discarded" ) );
+	EXPECT_EQ( rttiTest::s_discardedPropertyInitsAmount, 0 );
+}
+
+namespace rttiTest
+{
+	struct SerializableElement
+	{
+		RTTI_DECLARE_STRUCT( SerializableElement );
+		std::string m_name;
+		Int32 m_value = 0;
+	};
+
+	class SerializableBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( SerializableBase );
+	public:
+		virtual ~SerializableBase() = default;
+		Int32 m_baseValue = 0;
+	};
+
+	class SerializableDerived : public SerializableBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( SerializableDerived, SerializableBase );
+	public:
+		std::string m_derivedValue;
+	};
+
+	struct SerializableStruct
+	{
+		RTTI_DECLARE_STRUCT( SerializableStruct );
+		Int32 m_int = 0;
+		Float m_float = 0.0f;
+		Double m_double = 0.0;
+		TestEnum m_enum = TestEnum::Zero;
+		std::string m_string;
+		Float m_floats[ 4 ] = {};
+		std::array< std::string, 2 > m_strings;
+		std::vector< Int32 > m_vector;
+		std::vector< SerializableElement > m_elements;
+		std::unordered_set< Int32 > m_set;
+		std::unordered_map< std::string, SerializableElement > m_map;
+		std::unique_ptr< SerializableBase > m_unique;
+		std::shared_ptr< SerializableElement > m_shared;
+		Int32* m_rawPtr = nullptr;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::SerializableElement,
+	RTTI_REGISTER_PROPERTY( m_name );
+	RTTI_REGISTER_PROPERTY( m_value );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::SerializableBase,
+	RTTI_REGISTER_PROPERTY( m_baseValue );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::SerializableDerived,
+	RTTI_REGISTER_PROPERTY( m_derivedValue );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::SerializableStruct,
+	RTTI_REGISTER_PROPERTY( m_int );
+	RTTI_REGISTER_PROPERTY( m_float );
+	RTTI_REGISTER_PROPERTY( m_double );
+	RTTI_REGISTER_PROPERTY( m_enum );
+	RTTI_REGISTER_PROPERTY( m_string );
+	RTTI_REGISTER_PROPERTY( m_floats );
+	RTTI_REGISTER_PROPERTY( m_strings );
+	RTTI_REGISTER_PROPERTY( m_vector );
+	RTTI_REGISTER_PROPERTY( m_elements );
+	RTTI_REGISTER_PROPERTY( m_set );
+	RTTI_REGISTER_PROPERTY( m_map );
+	RTTI_REGISTER_PROPERTY( m_unique );
+	RTTI_REGISTER_PROPERTY( m_shared );
+	RTTI_REGISTER_PROPERTY( m_rawPtr );
+);
+
+static void FillSerializableStruct( rttiTest::SerializableStruct& obj )
+{
+	obj.m_int = 123;
+	obj.m_float = 3.14f;
+	obj.m_double = 2.71;
+	obj.m_enum = rttiTest::TestEnum::Seven;
+	obj.m_string = "Hello";
+	obj.m_floats[ 2 ] = 1.5f;
+	obj.m_strings[ 1 ] = "World";
+	obj.m_vector = { 1, 2, 3, 4, 5 };
+	obj.m_elements = { { "First", 1 }, { "Second", 2 } };
+	obj.m_set = { 7, 8, 9 };
+	obj.m_map[ "Key" ] = { "Value", 3 };
+	auto derived = std::make_unique< rttiTest::SerializableDerived >();
+	derived->m_baseValue = 11;
+	derived->m_derivedValue = "Derived";
+	obj.m_unique = std::move( derived );
+	obj.m_shared = std::make_shared< rttiTest::SerializableElement >( rttiTest::SerializableElement{ "Shared", 4 } );
+	obj.m_rawPtr = &obj.m_int;
+}
+
+static void TestSerializableStruct( const rttiTest::SerializableStruct& obj )
+{
+	EXPECT_EQ( obj.m_int, 123 );
+	EXPECT_EQ( obj.m_float, 3.14f );
+	EXPECT_EQ( obj.m_double, 2.71 );
+	EXPECT_EQ( obj.m_enum, rttiTest::TestEnum::Seven );
+	EXPECT_EQ( obj.m_string, "Hello" );
+	EXPECT_EQ( obj.m_floats[ 2 ], 1.5f );
+	EXPECT_EQ( obj.m_strings[ 1 ], "World" );
+	EXPECT_EQ( obj.m_vector, std::vector< Int32 >( { 1, 2, 3, 4, 5 } ) );
+	ASSERT_EQ( obj.m_elements.size(), 2u );
+	EXPECT_EQ( obj.m_elements[ 1 ].m_name, "Second" );
+	EXPECT_EQ( obj.m_elements[ 1 ].m_value, 2 );
+	EXPECT_EQ( obj.m_set, std::unordered_set< Int32 >( { 7, 8, 9 } ) );
+	ASSERT_TRUE( obj.m_map.contains( "Key" ) );
+	EXPECT_EQ( obj.m_map.at( "Key" ).m_name, "Value" );
+	ASSERT_TRUE( obj.m_unique );
+	ASSERT_TRUE( obj.m_unique->IsA< rttiTest::SerializableDerived >() );
+	EXPECT_EQ( obj.m_unique->m_baseValue, 11 );
+	EXPECT_EQ( static_cast< const rttiTest::SerializableDerived& >( *obj.m_unique ).m_derivedValue, "Derived" );
+	ASSERT_TRUE( obj.m_shared );
+	EXPECT_EQ( obj.m_shared->m_name, "Shared" );
+}
+
+TEST( TestCaseName, TypePlan )
+{
+	const auto& plan = ::rtti::internal::TypePlan::Get( rttiTest::SerializableElement::GetTypeStatic() );
+	EXPECT_EQ( plan.GetOps().size(), 2u );
+	EXPECT_FALSE( plan.IsTriviallyCopyable() );
+
+	const auto& someStructPlan = ::rtti::internal::TypePlan::Get( rttiTest::SomeStruct::GetTypeStatic() );
+	EXPECT_EQ( someStructPlan.GetOps().size(), 2u );
+
+	const auto& arrayPlan = ::rtti::internal::TypePlan::Get( ::rtti::GetTypeInstanceOf< Float[ 4 ] >() );
+	EXPECT_TRUE( arrayPlan.IsTriviallyCopyable() );
+
+	// The first access compiles the plan, the others have to get the same, complete one.
+	auto& runtimeType = ::rtti::RuntimeType<>::Create( "TypePlanConcurrentAccess" );
+	runtimeType.AddProperty< Int32 >( "m_int" );
+	runtimeType.AddProperty< std::vector< std::string > >( "m_strings" );
+	std::vector< const ::rtti::internal::TypePlan* > plans( 8u );
+	std::vector< std::thread > threads;
+	for ( size_t i = 0u; i < plans.size(); ++i )
+	{
+		threads.emplace_back( [ &, i ]() { plans[ i ] = &::rtti::internal::TypePlan::Get( runtimeType ); } );
+	}
+
+	for ( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+
+	for ( const auto* runtimePlan : plans )
+	{
+		EXPECT_EQ( runtimePlan, plans[ 0u ] );
+		EXPECT_EQ( runtimePlan->GetOps().size(), 2u );
+	}
+}
+
+TEST( TestCaseName, BinarySerialization )
+{
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+
+	std::vector< uint8_t > buffer;
+	::rtti::BinarySerializer::Save( source, buffer );
+
+	rttiTest::SerializableStruct destination;
+	destination.m_vector = { 100 };
+	destination.m_rawPtr = &destination.m_int;
+	EXPECT_TRUE( ::rtti::BinarySerializer::Load( destination, buffer ) );
+	TestSerializableStruct( destination );
+	EXPECT_EQ( destination.m_rawPtr, nullptr );
+
+	buffer.pop_back();
+	rttiTest::SerializableStruct truncated;
+	EXPECT_FALSE( ::rtti::BinarySerializer::Load( truncated, buffer ) );
+
+	// Amount of elements which can't fit into the remaining data.
+	std::vector< uint8_t > stringsBuffer;
+	::rtti::BinarySerializer::Save( std::vector< std::string >{ "A" }, stringsBuffer );
+	const ::rtti::uint64 corruptedAmount = ::rtti::uint64( 1u ) << 40u;
+	std::memcpy( stringsBuffer.data(), &corruptedAmount, sizeof( corruptedAmount ) );
+	std::vector< std::string > strings;
+	EXPECT_FALSE( ::rtti::BinarySerializer::Load( strings, stringsBuffer ) );
+	EXPECT_EQ( strings.capacity(), 0u );
+
+	// Raw pointers take no bytes, amounts of them are capped instead.
+	std::vector< uint8_t > pointersBuffer;
+	::rtti::BinarySerializer::Save( std::vector< Int32* >{ nullptr }, pointersBuffer );
+	std::memcpy( pointersBuffer.data(), &corruptedAmount, sizeof( corruptedAmount ) );
+	std::vector< Int32* > pointers;
+	EXPECT_FALSE( ::rtti::BinarySerializer::Load( pointers, pointersBuffer ) );
+}
+
+TEST( TestCaseName, BinarySerializationOfGrowingRuntimeType )
+{
+	auto& type = ::rtti::RuntimeType<>::Create( "BinarySerializationGrowingRuntimeType" );
+	type.AddProperty< Int32 >( "m_int" );
+
+	alignas( 16 ) uint8_t object[ 64 ];
+	type.ConstructInPlace( object );
+	type.FindProperty( "m_int" )->GetValue< Int32 >( object ) = 3;
+	std::vector< uint8_t > buffer;
+	::rtti::BinarySerializer::Save( object, type, buffer );
+	EXPECT_EQ( buffer.size(), sizeof( Int32 ) );
+	type.Destroy( object );
+
+	// The plan compiled by the first save has to be dropped.
+	type.AddProperty< std::string >( "m_string" );
+	ASSERT_LE( type.GetSize(), sizeof( object ) );
+	type.ConstructInPlace( object );
+	type.FindProperty( "m_int" )->GetValue< Int32 >( object ) = 5;
+	type.FindProperty( "m_string" )->GetValue< std::string >( object ) = "Added";
+	buffer.clear();
+	::rtti::BinarySerializer::Save( object, type, buffer );
+	type.Destroy( object );
+
+	type.ConstructInPlace( object );
+	EXPECT_TRUE( ::rtti::BinarySerializer::Load( object, type, buffer.data(), buffer.size() ) );
+	EXPECT_EQ( type.FindProperty( "m_int" )->GetValue< Int32 >( object ), 5 );
+	EXPECT_EQ( type.FindProperty( "m_string" )->GetValue< std::string >( object ), "Added" );
+	type.Destroy( object );
+}
+
+TEST( TestCaseName, VersionedBinarySerialization )
+{
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+
+	std::vector< uint8_t > buffer;
+	::rtti::VersionedBinarySerializer::Save( source, buffer );
+
+	rttiTest::SerializableStruct destination;
+	EXPECT_TRUE( ::rtti::VersionedBinarySerializer::Load( destination, buffer ) );
+	TestSerializableStruct( destination );
+	EXPECT_EQ( destination.m_rawPtr, nullptr );
+
+	rttiTest::SerializableElement wrongType;
+	EXPECT_FALSE( ::rtti::VersionedBinarySerializer::Load( wrongType, buffer ) );
+}
+
+TEST( TestCaseName, VersionedBinarySerializationOfGrowingRuntimeType )
+{
+	auto& type = ::rtti::RuntimeType<>::Create( "VersionedSerializationGrowingRuntimeType" );
+	type.AddProperty< Int32 >( "m_int" );
+
+	alignas( 16 ) uint8_t object[ 64 ];
+	type.ConstructInPlace( object );
+	type.FindProperty( "m_int" )->GetValue< Int32 >( object ) = 3;
+	std::vector< uint8_t > oldBuffer;
+	::rtti::VersionedBinarySerializer::Save( object, type, oldBuffer );
+	EXPECT_TRUE( ::rtti::VersionedBinarySerializer::Load( object, type, oldBuffer.data(), oldBuffer.size() ) );
+	type.Destroy( object );
+
+	// Both the layout and the remap plan of the old schema have to be rebuilt.
+	type.AddProperty< std::string >( "m_string" );
+	ASSERT_LE( type.GetSize(), sizeof( object ) );
+	type.ConstructInPlace( object );
+	type.FindProperty( "m_string" )->GetValue< std::string >( object ) = "NotDefault";
+	EXPECT_TRUE( ::rtti::VersionedBinarySerializer::Load( object, type, oldBuffer.data(), oldBuffer.size() ) );
+	EXPECT_EQ( type.FindProperty( "m_int" )->GetValue< Int32 >( object ), 3 );
+	EXPECT_EQ( type.FindProperty( "m_string" )->GetValue< std::string >( object ), "" );
+
+	type.FindProperty( "m_int" )->GetValue< Int32 >( object ) = 5;
+	type.FindProperty( "m_string" )->GetValue< std::string >( object ) = "Added";
+	std::vector< uint8_t > newBuffer;
+	::rtti::VersionedBinarySerializer::Save( object, type, newBuffer );
+	type.Destroy( object );
+
+	type.ConstructInPlace( object );
+	EXPECT_TRUE( ::rtti::VersionedBinarySerializer::Load( object, type, newBuffer.data(), newBuffer.size() ) );
+	EXPECT_EQ( type.FindProperty( "m_int" )->GetValue< Int32 >( object ), 5 );
+	EXPECT_EQ( type.FindProperty( "m_string" )->GetValue< std::string >( object ), "Added" );
+	type.Destroy( object );
+}
+
+TEST( TestCaseName, VersionedBinarySerializationSchemaChanges )
+{
+	auto& oldType = ::rtti::RuntimeType<>::Create( "VersionedSerializationOld" );
+	oldType.AddProperty< Int32 >( "m_int" );
+	oldType.AddProperty< std::string >( "m_removedString" );
+	oldType.AddProperty< Float >( "m_removedFloat" );
+	oldType.AddProperty< std::vector< rttiTest::SerializableElement > >( "m_elements" );
+	oldType.AddProperty< Double >( "m_double" );
+
+	auto& newType = ::rtti::RuntimeType<>::Create( "VersionedSerializationNew" );
+	newType.AddProperty< std::vector< rttiTest::SerializableElement > >( "m_elements" );
+	newType.AddProperty< Double >( "m_double" );
+	newType.AddProperty< Int32 >( "m_int" );
+	newType.AddProperty< std::string >( "m_addedString" );
+
+	std::unique_ptr< Byte[] > oldObject( new Byte[ oldType.GetSize() ] );
+	oldType.ConstructInPlace( oldObject.get() );
+	oldType.FindProperty( "m_int" )->GetValue< Int32 >( oldObject.get() ) = 42;
+	oldType.FindProperty( "m_removedString" )->GetValue< std::string >( oldObject.get() ) = "Removed";
+	oldType.FindProperty( "m_removedFloat" )->GetValue< Float >( oldObject.get() ) = 1.0f;
+	oldType.FindProperty( "m_elements" )->GetValue< std::vector< rttiTest::SerializableElement > >( oldObject.get() ) = { { "Element", 5 } };
+	oldType.FindProperty( "m_double" )->GetValue< Double >( oldObject.get() ) = 0.5;
+
+	std::vector< uint8_t > buffer;
+	::rtti::VersionedBinarySerializer::Save( oldObject.get(), oldType, buffer );
+	oldType.Destroy( oldObject.get() );
+
+	// Simulates renaming of the type, so the stored data describes an older version of the new type.
+	const ::rtti::ID oldId = oldType.GetID();
+	const ::rtti::ID newId = newType.GetID();
+	for ( size_t i = 0u; i + sizeof( ::rtti::ID ) <= buffer.size(); ++i )
+	{
+		if ( std::memcmp( &buffer[ i ], &oldId, sizeof( ::rtti::ID ) ) == 0 )
+		{
+			std::memcpy( &buffer[ i ], &newId, sizeof( ::rtti::ID ) );
+		}
+	}
+
+	std::unique_ptr< Byte[] > newObject( new Byte[ newType.GetSize() ] );
+	newType.ConstructInPlace( newObject.get() );
+	newType.FindProperty( "m_addedString" )->GetValue< std::string >( newObject.get() ) = "NotDefault";
+
+	EXPECT_TRUE( ::rtti::VersionedBinarySerializer::Load( newObject.get(), newType, buffer.data(), buffer.size() ) );
+	EXPECT_EQ( newType.FindProperty( "m_int" )->GetValue< Int32 >( newObject.get() ), 42 );
+	EXPECT_EQ( newType.FindProperty( "m_double" )->GetValue< Double >( newObject.get() ), 0.5 );
+	EXPECT_EQ( newType.FindProperty( "m_addedString" )->GetValue< std::string >( newObject.get() ), "" );
+	const auto& elements = newType.FindProperty( "m_elements" )->GetValue< std::vector< rttiTest::SerializableElement > >( newObject.get() );
+	ASSERT_EQ( elements.size(), 1u );
+	EXPECT_EQ( elements[ 0 ].m_name, "Element" );
+	EXPECT_EQ( elements[ 0 ].m_value, 5 );
+	newType.Destroy( newObject.get() );
+}
+
+namespace rttiTest
+{
+	struct BlobPoint
+	{
+		RTTI_DECLARE_STRUCT( BlobPoint );
+		Float m_x = 0.0f;
+		Float m_y = 0.0f;
+	};
+
+	struct BlobLevel
+	{
+		RTTI_DECLARE_STRUCT( BlobLevel );
+		Int32 m_id = 0;
+		std::string m_name;
+		std::vector< BlobPoint > m_points;
+		std::vector< std::string > m_tags;
+		Float m_bounds[ 4 ] = {};
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::BlobPoint,
+	RTTI_REGISTER_PROPERTY( m_x );
+	RTTI_REGISTER_PROPERTY( m_y );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::BlobLevel,
+	RTTI_REGISTER_PROPERTY( m_id );
+	RTTI_REGISTER_PROPERTY( m_name );
+	RTTI_REGISTER_PROPERTY( m_points );
+	RTTI_REGISTER_PROPERTY( m_tags );
+	RTTI_REGISTER_PROPERTY( m_bounds );
+);
+
+TEST( TestCaseName, ObjectBlob )
+{
+	rttiTest::BlobLevel level;
+	level.m_id = 7;
+	level.m_name = "Level";
+	level.m_points = { { 1.0f, 2.0f }, { 3.0f, 4.0f } };
+	level.m_tags = { "First", "Second" };
+	level.m_bounds[ 3 ] = 5.0f;
+
+	std::vector< uint8_t > blob;
+	ASSERT_TRUE( ::rtti::BlobWriter::Write( level, blob ) );
+
+	const auto reader = ::rtti::BlobReader::Create< rttiTest::BlobLevel >( blob.data(), blob.size() );
+	ASSERT_TRUE( reader.IsValid() );
+	EXPECT_EQ( reader.GetRootAs< rttiTest::BlobLevel >(), nullptr );
+
+	const ::rtti::BlobObjectView root = reader.GetRoot();
+	ASSERT_NE( root.GetValue< Int32 >( "m_id" ), nullptr );
+	EXPECT_EQ( *root.GetValue< Int32 >( "m_id" ), 7 );
+	EXPECT_EQ( root.GetValue< Float >( "m_id" ), nullptr );
+	EXPECT_EQ( root.GetString( "m_name" ), "Level" );
+
+	const ::rtti::BlobArrayView points = root.GetArray( "m_points" );
+	ASSERT_EQ( points.GetSize(), 2u );
+	ASSERT_NE( points.GetData< rttiTest::BlobPoint >(), nullptr );
+	EXPECT_EQ( points.GetData< rttiTest::BlobPoint >()[ 1 ].m_y, 4.0f );
+	EXPECT_EQ( *points.GetObject( 0 ).GetValue< Float >( "m_x" ), 1.0f );
+
+	const ::rtti::BlobArrayView tags = root.GetArray( "m_tags" );
+	ASSERT_EQ( tags.GetSize(), 2u );
+	EXPECT_EQ( tags.GetString( 1 ), "Second" );
+	EXPECT_EQ( root.GetArray( "m_bounds" ).GetData< Float >()[ 3 ], 5.0f );
+
+	// Records pointing outside of the blob.
+	const size_t nameRecordPosition = static_cast< const uint8_t* >( root.GetAddress() ) - blob.data() + rttiTest::BlobLevel::GetTypeStatic().FindProperty( "m_name" )->GetOffset();
+	for ( const ::rtti::int64 offset : { std::numeric_limits< ::rtti::int64 >::max(), std::numeric_limits< ::rtti::int64 >::min(), -static_cast< ::rtti::int64 >( nameRecordPosition ) - 1 } )
+	{
+		std::vector< uint8_t > corrupted = blob;
+		std::memcpy( corrupted.data() + nameRecordPosition, &offset, sizeof( offset ) );
+		const auto corruptedReader = ::rtti::BlobReader::Create< rttiTest::BlobLevel >( corrupted.data(), corrupted.size() );
+		ASSERT_TRUE( corruptedReader.IsValid() );
+		EXPECT_TRUE( corruptedReader.GetRoot().GetString( "m_name" ).empty() );
+	}
+
+	const auto pointReader = ::rtti::BlobReader::Create< rttiTest::BlobPoint >( blob.data(), blob.size() );
+	EXPECT_FALSE( pointReader.IsValid() );
+
+	const auto truncatedReader = ::rtti::BlobReader::Create< rttiTest::BlobLevel >( blob.data(), blob.size() - 1u );
+	EXPECT_FALSE( truncatedReader.IsValid() );
+
+	rttiTest::SerializableStruct unsupported;
+	EXPECT_FALSE( ::rtti::BlobWriter::Write( unsupported, blob ) );
+}
+
+TEST( TestCaseName, ObjectBlobTriviallyCopyableRoot )
+{
+	rttiTest::BlobPoint point{ 1.5f, 2.5f };
+	std::vector< uint8_t > blob;
+	ASSERT_TRUE( ::rtti::BlobWriter::Write( point, blob ) );
+
+	const auto reader = ::rtti::BlobReader::Create< rttiTest::BlobPoint >( blob.data(), blob.size() );
+	ASSERT_NE( reader.GetRootAs< rttiTest::BlobPoint >(), nullptr );
+	EXPECT_EQ( reader.GetRootAs< rttiTest::BlobPoint >()->m_y, 2.5f );
+}
+
+TEST( TestCaseName, LayoutHash )
+{
+	const auto& levelType = rttiTest::BlobLevel::GetTypeStatic();
+	EXPECT_NE( levelType.GetLayoutHash(), 0u );
+	EXPECT_EQ( levelType.GetLayoutHash(), levelType.GetLayoutHash() );
+	EXPECT_NE( levelType.GetLayoutHash(), rttiTest::BlobPoint::GetTypeStatic().GetLayoutHash() );
+	EXPECT_NE( ::rtti::GetTypeInstanceOf< Float[ 4 ] >().GetLayoutHash(), ::rtti::GetTypeInstanceOf< Int32[ 4 ] >().GetLayoutHash() );
+
+	auto& runtimeType = ::rtti::RuntimeType<>::Create( "LayoutHashRuntimeType" );
+	runtimeType.AddProperty< Int32 >( "m_first" );
+	const ::rtti::uint64 initialHash = runtimeType.GetLayoutHash();
+	runtimeType.AddProperty< Double >( "m_second" );
+	EXPECT_NE( runtimeType.GetLayoutHash(), initialHash );
+
+	// Types derived from a runtime type or embedding it change with it.
+	auto& derivedType = ::rtti::RuntimeType< ::rtti::RuntimeType<> >::Create( "LayoutHashDerivedRuntimeType", runtimeType );
+	auto& embeddingType = ::rtti::RuntimeType<>::Create( "LayoutHashEmbeddingRuntimeType" );
+	embeddingType.AddProperty( "m_embedded", runtimeType, ::rtti::InstanceFlags::None );
+	const ::rtti::uint64 derivedHash = derivedType.GetLayoutHash();
+	const ::rtti::uint64 embeddingHash = embeddingType.GetLayoutHash();
+	runtimeType.AddProperty< Int32 >( "m_third" );
+	EXPECT_NE( derivedType.GetLayoutHash(), derivedHash );
+	EXPECT_NE( embeddingType.GetLayoutHash(), embeddingHash );
+}
+
+TEST( TestCaseName, JsonSerialization )
+{
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+
+	std::string json;
+	::rtti::JsonSerializer::Save( source, json );
+	EXPECT_NE( json.find( "\"m_enum\":\"Seven\"" ), std::string::npos );
+	EXPECT_NE( json.find( "\"$type\":\"rttiTest::SerializableDerived\"" ), std::string::npos );
+
+	rttiTest::SerializableStruct destination;
+	destination.m_rawPtr = &destination.m_int;
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( destination, json ) );
+	TestSerializableStruct( destination );
+	EXPECT_EQ( destination.m_rawPtr, nullptr );
+
+	json.pop_back();
+	rttiTest::SerializableStruct truncated;
+	EXPECT_FALSE( ::rtti::JsonSerializer::Load( truncated, json ) );
+}
+
+TEST( TestCaseName, JsonReading )
+{
+	rttiTest::SerializableElement element{ "Quote\" \\ \n", -3 };
+	std::string json;
+	::rtti::JsonSerializer::Save( element, json );
+	EXPECT_EQ( json, "{\"m_name\":\"Quote\\\" \\\\ \\n\",\"m_value\":-3}" );
+
+	rttiTest::SerializableElement loaded;
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( loaded, " { \"m_unknown\" : [ 1, { \"a\" : null } ], \"m_value\" : 12,\n\"m_name\" : \"\\u00e9\\ud83d\\ude00\" } " ) );
+	EXPECT_EQ( loaded.m_value, 12 );
+	EXPECT_EQ( loaded.m_name, "\xC3\xA9\xF0\x9F\x98\x80" );
+
+	EXPECT_FALSE( ::rtti::JsonSerializer::Load( loaded, "{\"m_value\":1.5}" ) );
+	EXPECT_FALSE( ::rtti::JsonSerializer::Load( loaded, "{\"m_value\":1} 2" ) );
+
+	// "Aa" and "BB" have the same hash.
+	auto& collidingType = ::rtti::RuntimeType<>::Create( "JsonReadingHashCollision" );
+	collidingType.AddProperty< Int32 >( "Aa" );
+	ASSERT_EQ( ::rtti::internal::CalcHash( "Aa" ), ::rtti::internal::CalcHash( "BB" ) );
+	Int32 colliding = 0;
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( &colliding, collidingType, "{\"BB\":5}" ) );
+	EXPECT_EQ( colliding, 0 );
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( &colliding, collidingType, "{\"Aa\":6}" ) );
+	EXPECT_EQ( colliding, 6 );
+
+	// Properties of runtime types might change between calls.
+	auto& growingType = ::rtti::RuntimeType<>::Create( "JsonReadingGrowingType" );
+	growingType.AddProperty< Int32 >( "m_first" );
+	alignas( 8 ) uint8_t memory[ 64 ] = {};
+	json.clear();
+	::rtti::JsonSerializer::Save( memory, growingType, json );
+	EXPECT_EQ( json, "{\"m_first\":0}" );
+
+	for ( Uint32 i = 0u; i < 8u; ++i )
+	{
+		growingType.AddProperty< Int32 >( ( "m_" + std::to_string( i ) ).c_str() );
+	}
+
+	json.clear();
+	::rtti::JsonSerializer::Save( memory, growingType, json );
+	EXPECT_NE( json.find( "\"m_7\":0" ), std::string::npos );
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( memory, growingType, "{\"m_7\":3}" ) );
+	EXPECT_EQ( *reinterpret_cast< Int32* >( memory + growingType.FindProperty( "m_7" )->GetOffset() ), 3 );
+}
+
+TEST( TestCaseName, MessagePackSerialization )
+{
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+
+	for ( auto keyMode : { ::rtti::MessagePackSerializer::KeyMode::PropertyId, ::rtti::MessagePackSerializer::KeyMode::Index } )
+	{
+		std::vector< uint8_t > buffer;
+		::rtti::MessagePackSerializer::Save( source, buffer, keyMode );
+
+		rttiTest::SerializableStruct destination;
+		destination.m_rawPtr = &destination.m_int;
+		EXPECT_TRUE( ::rtti::MessagePackSerializer::Load( destination, buffer, keyMode ) );
+		TestSerializableStruct( destination );
+		EXPECT_EQ( destination.m_rawPtr, nullptr );
+
+		buffer.pop_back();
+		rttiTest::SerializableStruct truncated;
+		EXPECT_FALSE( ::rtti::MessagePackSerializer::Load( truncated, buffer, keyMode ) );
+	}
+}
+
+TEST( TestCaseName, MessagePackEncoding )
+{
+	rttiTest::SerializableElement element{ "A", -3 };
+	std::vector< uint8_t > buffer;
+	::rtti::MessagePackSerializer::Save( element, buffer, ::rtti::MessagePackSerializer::KeyMode::Index );
+	EXPECT_EQ( buffer, std::vector< uint8_t >( { 0x82, 0x00, 0xA1, 'A', 0x01, 0xFD } ) );
+
+	// Unknown keys are skipped.
+	const std::vector< uint8_t > withUnknownKey = { 0x82, 0x05, 0x92, 0xC3, 0xA1, 'B', 0x01, 0x07 };
+	rttiTest::SerializableElement loaded;
+	EXPECT_TRUE( ::rtti::MessagePackSerializer::Load( loaded, withUnknownKey, ::rtti::MessagePackSerializer::KeyMode::Index ) );
+	EXPECT_EQ( loaded.m_value, 7 );
+
+	std::vector< Int32 > numbers = { 1, 2, 3 };
+	buffer.clear();
+	::rtti::MessagePackSerializer::Save( numbers, buffer );
+	ASSERT_EQ( buffer.size(), 2u + sizeof( Int32 ) * 3u );
+	EXPECT_EQ( buffer[ 0 ], 0xC4 );
+
+	// Properties of runtime types might change between calls.
+	auto& growingType = ::rtti::RuntimeType<>::Create( "MessagePackEncodingGrowingType" );
+	growingType.AddProperty< Int32 >( "m_first" );
+	alignas( 8 ) uint8_t source[ 64 ] = {};
+	alignas( 8 ) uint8_t destination[ 64 ] = {};
+	buffer.clear();
+	::rtti::MessagePackSerializer::Save( source, growingType, buffer );
+	EXPECT_TRUE( ::rtti::MessagePackSerializer::Load( destination, growingType, buffer.data(), buffer.size() ) );
+
+	for ( Uint32 i = 0u; i < 8u; ++i )
+	{
+		growingType.AddProperty< Int32 >( ( "m_" + std::to_string( i ) ).c_str() );
+	}
+
+	const size_t offset = growingType.FindProperty( "m_7" )->GetOffset();
+	*reinterpret_cast< Int32* >( source + offset ) = 9;
+	buffer.clear();
+	::rtti::MessagePackSerializer::Save( source, growingType, buffer );
+	EXPECT_TRUE( ::rtti::MessagePackSerializer::Load( destination, growingType, buffer.data(), buffer.size() ) );
+	EXPECT_EQ( *reinterpret_cast< Int32* >( destination + offset ), 9 );
+}
+
+TEST( TestCaseName, ParallelBinarySerialization )
+{
+	std::vector< rttiTest::SerializableElement > elements( 5000u );
+	for ( size_t i = 0u; i < elements.size(); ++i )
+	{
+		elements[ i ] = { std::to_string( i ), static_cast< Int32 >( i ) };
+	}
+
+	std::vector< uint8_t > singleThreadBuffer;
+	std::vector< uint8_t > buffer;
+	::rtti::BinarySerializer::SaveParallel( elements, singleThreadBuffer, 1u );
+	::rtti::BinarySerializer::SaveParallel( elements, buffer, 4u );
+	EXPECT_EQ( singleThreadBuffer, buffer );
+
+	// Parallel functions use the same format.
+	std::vector< uint8_t > sequentialElementsBuffer;
+	::rtti::BinarySerializer::Save( elements, sequentialElementsBuffer );
+	EXPECT_EQ( sequentialElementsBuffer, buffer );
+
+	std::vector< rttiTest::SerializableElement > loadedElements;
+	ASSERT_TRUE( ::rtti::BinarySerializer::Load( loadedElements, buffer ) );
+	EXPECT_EQ( loadedElements[ 1234 ].m_name, "1234" );
+
+	ASSERT_TRUE( ::rtti::BinarySerializer::LoadParallel( loadedElements, buffer, 4u ) );
+	ASSERT_EQ( loadedElements.size(), elements.size() );
+	EXPECT_EQ( loadedElements[ 4321 ].m_name, "4321" );
+	EXPECT_EQ( loadedElements[ 4321 ].m_value, 4321 );
+
+	buffer.pop_back();
+	EXPECT_FALSE( ::rtti::BinarySerializer::LoadParallel( loadedElements, buffer, 4u ) );
+
+	// Trivially copyable data keeps the sequential format.
+	std::vector< Int32 > numbers( 1024u * 1024u );
+	for ( size_t i = 0u; i < numbers.size(); ++i )
+	{
+		numbers[ i ] = static_cast< Int32 >( i );
+	}
+
+	std::vector< uint8_t > sequentialBuffer;
+	buffer.clear();
+	::rtti::BinarySerializer::Save( numbers, sequentialBuffer );
+	::rtti::BinarySerializer::SaveParallel( numbers, buffer, 4u );
+	EXPECT_EQ( sequentialBuffer, buffer );
+
+	std::vector< Int32 > loadedNumbers;
+	ASSERT_TRUE( ::rtti::BinarySerializer::LoadParallel( loadedNumbers, buffer, 4u ) );
+	EXPECT_EQ( loadedNumbers, numbers );
+
+	// Skipped elements with amounts of raw pointers that can't be bounded by the remaining data.
+	std::vector< std::vector< Int32* > > nestedPointers( 4096u );
+	buffer.clear();
+	::rtti::BinarySerializer::Save( nestedPointers, buffer );
+	const ::rtti::uint64 corruptedAmount = ::rtti::uint64( 1u ) << 40u;
+	std::memcpy( buffer.data() + sizeof( ::rtti::uint64 ), &corruptedAmount, sizeof( corruptedAmount ) );
+	EXPECT_FALSE( ::rtti::BinarySerializer::LoadParallel( nestedPointers, buffer, 4u ) );
+
+	// Raw pointers aren't stored, so their elements take no bytes.
+	Int32 pointee = 0;
+	const std::vector< Int32* > pointers( 4096u, &pointee );
+	std::vector< uint8_t > pointersBuffer;
+	buffer.clear();
+	::rtti::BinarySerializer::Save( pointers, pointersBuffer );
+	::rtti::BinarySerializer::SaveParallel( pointers, buffer, 4u );
+	EXPECT_EQ( pointersBuffer, buffer );
+	std::vector< Int32* > loadedPointers;
+	ASSERT_TRUE( ::rtti::BinarySerializer::Load( loadedPointers, buffer ) );
+	EXPECT_EQ( loadedPointers, std::vector< Int32* >( 4096u, nullptr ) );
+	loadedPointers.clear();
+	ASSERT_TRUE( ::rtti::BinarySerializer::LoadParallel( loadedPointers, buffer, 4u ) );
+	EXPECT_EQ( loadedPointers, std::vector< Int32* >( 4096u, nullptr ) );
+	std::memcpy( buffer.data(), &corruptedAmount, sizeof( corruptedAmount ) );
+	EXPECT_FALSE( ::rtti::BinarySerializer::LoadParallel( loadedPointers, buffer, 4u ) );
+
+	// Exceptions thrown on workers are rethrown on the calling thread.
+	EXPECT_THROW( ::rtti::internal::RunParallel( 64u, 4u, []( size_t task )
+		{
+			if ( task == 3u )
+			{
+				throw std::runtime_error( "Task failed" );
+			}
+		} ), std::runtime_error );
+}
+
+TEST( TestCaseName, IncrementalBinarySaver )
+{
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+
+	std::vector< uint8_t > expectedBuffer;
+	::rtti::BinarySerializer::Save( source, expectedBuffer );
+
+	std::vector< uint8_t > buffer;
+	::rtti::IncrementalBinarySaver saver( source, buffer );
+	size_t stepsAmount = 1u;
+	while ( !saver.Step( std::chrono::nanoseconds( 0 ) ) )
+	{
+		++stepsAmount;
+	}
+
+	EXPECT_TRUE( saver.IsFinished() );
+	EXPECT_GT( stepsAmount, 1u );
+	EXPECT_EQ( buffer, expectedBuffer );
+
+	rttiTest::SerializableStruct destination;
+	EXPECT_TRUE( ::rtti::BinarySerializer::Load( destination, buffer ) );
+	TestSerializableStruct( destination );
+}
+
+namespace rttiTest
+{
+	struct GraphNode
+	{
+		RTTI_DECLARE_STRUCT( GraphNode );
+		Int32 m_value = 0;
+		std::vector< std::shared_ptr< GraphNode > > m_children;
+		GraphNode* m_parent = nullptr;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::GraphNode,
+	RTTI_REGISTER_PROPERTY( m_value );
+	RTTI_REGISTER_PROPERTY( m_children );
+	RTTI_REGISTER_PROPERTY( m_parent );
+);
+
+namespace rttiTest
+{
+	struct GraphNodesMap
+	{
+		RTTI_DECLARE_STRUCT( GraphNodesMap );
+		GraphNode m_root;
+		std::unordered_map< Int32, GraphNode > m_nodes;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::GraphNodesMap,
+	RTTI_REGISTER_PROPERTY( m_root );
+	RTTI_REGISTER_PROPERTY( m_nodes );
+);
+
+TEST( TestCaseName, GraphWalker )
+{
+	rttiTest::GraphNode root;
+	auto shared = std::make_shared< rttiTest::GraphNode >();
+	shared->m_value = 3;
+	shared->m_parent = &root;
+	root.m_children = { std::make_shared< rttiTest::GraphNode >(), std::make_shared< rttiTest::GraphNode >() };
+	root.m_children[ 0 ]->m_children.push_back( shared );
+	root.m_children[ 1 ]->m_children.push_back( shared );
+
+	::rtti::GraphWalker walker;
+	Int32 valuesSum = 0;
+	const size_t visitedAmount = walker.Walk( &root, rttiTest::GraphNode::GetTypeStatic(), [ & ]( const void* address, const ::rtti::Type& type )
+		{
+			EXPECT_EQ( type, rttiTest::GraphNode::GetTypeStatic() );
+			valuesSum += static_cast< const rttiTest::GraphNode* >( address )->m_value;
+			return ::rtti::VisitOutcome::Continue;
+		} );
+	EXPECT_EQ( visitedAmount, 4u );
+	EXPECT_EQ( valuesSum, 3 );
+
+	rttiTest::SerializableStruct serializable;
+	FillSerializableStruct( serializable );
+	bool foundDerived = false;
+	EXPECT_EQ( walker.Walk( &serializable, rttiTest::SerializableStruct::GetTypeStatic(), [ & ]( const void* address, const ::rtti::Type& type )
+		{
+			foundDerived |= type == rttiTest::SerializableDerived::GetTypeStatic();
+			return ::rtti::VisitOutcome::Continue;
+		} ), 4u );
+	EXPECT_TRUE( foundDerived );
+
+	EXPECT_EQ( walker.Walk( &root, rttiTest::GraphNode::GetTypeStatic(), []( const void*, const ::rtti::Type& ) { return ::rtti::VisitOutcome::Break; } ), 1u );
+}
+
+TEST( TestCaseName, DeepClone )
+{
+	rttiTest::GraphNode root;
+	auto shared = std::make_shared< rttiTest::GraphNode >();
+	shared->m_value = 3;
+	shared->m_parent = &root;
+	root.m_children = { std::make_shared< rttiTest::GraphNode >(), std::make_shared< rttiTest::GraphNode >() };
+	root.m_children[ 0 ]->m_children.push_back( shared );
+	root.m_children[ 1 ]->m_children.push_back( shared );
+
+	std::unique_ptr< rttiTest::GraphNode > clone = ::rtti::DeepClone( root );
+	ASSERT_EQ( clone->m_children.size(), 2u );
+	const auto& clonedShared = clone->m_children[ 0 ]->m_children[ 0 ];
+	EXPECT_NE( clonedShared, shared );
+	EXPECT_EQ( clonedShared, clone->m_children[ 1 ]->m_children[ 0 ] );
+	EXPECT_EQ( clonedShared->m_value, 3 );
+	EXPECT_EQ( clonedShared->m_parent, clone.get() );
+	EXPECT_EQ( clonedShared.use_count(), 2 );
+
+	rttiTest::SerializableStruct source;
+	FillSerializableStruct( source );
+	Int32 external = 0;
+	rttiTest::SerializableStruct destination;
+	::rtti::DeepCloneInto( &source, &destination, rttiTest::SerializableStruct::GetTypeStatic() );
+	TestSerializableStruct( destination );
+	EXPECT_EQ( destination.m_rawPtr, &destination.m_int );
+	EXPECT_NE( destination.m_unique.get(), source.m_unique.get() );
+	EXPECT_NE( dynamic_cast< rttiTest::SerializableDerived* >( destination.m_unique.get() ), nullptr );
+	EXPECT_NE( destination.m_shared, source.m_shared );
+
+	source.m_rawPtr = &external;
+	::rtti::DeepCloneInto( &source, &destination, rttiTest::SerializableStruct::GetTypeStatic() );
+	EXPECT_EQ( destination.m_rawPtr, &external );
+
+	// Raw pointers inside of elements of maps.
+	rttiTest::GraphNodesMap nodesMap;
+	rttiTest::GraphNode externalNode;
+	for ( Int32 i = 0; i < 16; ++i )
+	{
+		rttiTest::GraphNode& node = nodesMap.m_nodes[ i ];
+		node.m_value = i;
+		node.m_parent = i % 2 == 0 ? &nodesMap.m_root : &externalNode;
+	}
+
+	rttiTest::GraphNodesMap clonedMap;
+	::rtti::DeepCloneInto( &nodesMap, &clonedMap, rttiTest::GraphNodesMap::GetTypeStatic() );
+	ASSERT_EQ( clonedMap.m_nodes.size(), 16u );
+	for ( const auto& [ key, node ] : clonedMap.m_nodes )
+	{
+		EXPECT_EQ( node.m_value, key );
+		EXPECT_EQ( node.m_parent, key % 2 == 0 ? &clonedMap.m_root : &externalNode );
+	}
+}
+
+TEST( TestCaseName, DeltaPatch )
+{
+	const ::rtti::Type& type = rttiTest::SerializableStruct::GetTypeStatic();
+	rttiTest::SerializableStruct oldObject;
+	FillSerializableStruct( oldObject );
+	oldObject.m_map[ "Removed" ] = { "Gone", 5 };
+
+	rttiTest::SerializableStruct newObject;
+	::rtti::DeepCloneInto( &oldObject, &newObject, type );
+	std::vector< uint8_t > patch;
+	EXPECT_FALSE( ::rtti::Diff( oldObject, newObject, patch ) );
+	EXPECT_TRUE( patch.empty() );
+
+	newObject.m_int = 7;
+	EXPECT_TRUE( ::rtti::Diff( oldObject, newObject, patch ) );
+	EXPECT_LT( patch.size(), 8u );
+
+	newObject.m_string = "Changed";
+	newObject.m_floats[ 3 ] = 2.5f;
+	newObject.m_vector = { 1, 2, 6 };
+	newObject.m_elements[ 1 ].m_value = 20;
+	newObject.m_elements.push_back( { "Third", 3 } );
+	newObject.m_set.erase( 7 );
+	newObject.m_set.insert( 10 );
+	newObject.m_map[ "Key" ].m_value = 30;
+	newObject.m_map[ "Added" ] = { "New", 6 };
+	newObject.m_map.erase( "Removed" );
+	static_cast< rttiTest::SerializableDerived& >( *newObject.m_unique ).m_derivedValue = "Patched";
+	newObject.m_shared = std::make_shared< rttiTest::SerializableElement >( rttiTest::SerializableElement{ "Replaced", 8 } );
+	EXPECT_TRUE( ::rtti::Diff( oldObject, newObject, patch ) );
+
+	rttiTest::SerializableStruct target;
+	::rtti::DeepCloneInto( &oldObject, &target, type );
+	const rttiTest::SerializableBase* unique = target.m_unique.get();
+	ASSERT_TRUE( ::rtti::ApplyPatch( target, patch ) );
+	EXPECT_EQ( target.m_unique.get(), unique );
+	EXPECT_EQ( target.m_int, 7 );
+	EXPECT_EQ( target.m_vector, newObject.m_vector );
+	EXPECT_EQ( target.m_elements.size(), 3u );
+	EXPECT_EQ( target.m_set, newObject.m_set );
+	EXPECT_EQ( target.m_map.size(), 2u );
+	EXPECT_EQ( target.m_map[ "Key" ].m_value, 30 );
+	EXPECT_EQ( static_cast< const rttiTest::SerializableDerived& >( *target.m_unique ).m_derivedValue, "Patched" );
+	EXPECT_EQ( target.m_shared->m_name, "Replaced" );
+
+	std::vector< uint8_t > remaining;
+	EXPECT_FALSE( ::rtti::Diff( target, newObject, remaining ) );
+
+	rttiTest::SerializableStruct mismatched;
+	EXPECT_FALSE( ::rtti::ApplyPatch( mismatched, patch ) );
+	patch.resize( patch.size() / 2u );
+	EXPECT_FALSE( ::rtti::ApplyPatch( target, patch ) );
+
+	// Appended raw pointers take no bytes in the patch and are loaded as nullptr.
+	Int32 first = 1;
+	Int32 second = 2;
+	std::vector< Int32* > pointers;
+	EXPECT_TRUE( ::rtti::Diff( std::vector< Int32* >{}, std::vector< Int32* >{ &first, &second }, patch ) );
+	ASSERT_TRUE( ::rtti::ApplyPatch( pointers, patch ) );
+	EXPECT_EQ( pointers, ( std::vector< Int32* >{ nullptr, nullptr } ) );
+}
+
+namespace rttiTest
+{
+	struct StaticBase
+	{
+		RTTI_DECLARE_STRUCT( StaticBase );
+		Int32 m_id = 0;
+	};
+
+	struct StaticDerived : public StaticBase
+	{
+		RTTI_DECLARE_STRUCT( StaticDerived, StaticBase );
+		Float m_weight = 0.0f;
+		std::string m_label;
+	};
+}
+
+RTTI_STATIC_PROPERTIES( rttiTest::StaticBase,
+	RTTI_STATIC_PROPERTY( m_id )
+);
+
+RTTI_STATIC_PROPERTIES( rttiTest::StaticDerived,
+	RTTI_STATIC_PROPERTY( m_weight, TryToAddMetadata( "Unit", "kg" ); ),
+	RTTI_STATIC_PROPERTY( m_label )
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::StaticBase,
+	RTTI_REGISTER_STATIC_PROPERTIES();
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::StaticDerived,
+	RTTI_REGISTER_STATIC_PROPERTIES();
+);
+
+TEST( TestCaseName, StaticProperties )
+{
+	static_assert( ::rtti::HasStaticProperties< rttiTest::StaticDerived >() );
+	static_assert( !::rtti::HasStaticProperties< rttiTest::SerializableStruct >() );
+	static_assert( ::rtti::GetStaticPropertiesAmount< rttiTest::StaticDerived >() == 3u );
+	static_assert( []()
+		{
+			rttiTest::StaticBase base;
+			base.m_id = 5;
+			Int32 result = 0;
+			::rtti::StaticVisitProperties( base, [ & ]( const char*, Int32 value ) { result = value; } );
+			return result;
+		}() == 5 );
+
+	const auto& type = rttiTest::StaticDerived::GetTypeStatic();
+	ASSERT_EQ( type.GetPropertiesAmount(), 3u );
+	EXPECT_STREQ( type.GetProperty( 0u )->GetName(), "m_id" );
+	EXPECT_EQ( type.GetProperty( 1u )->GetOffset(), offsetof( rttiTest::StaticDerived, m_weight ) );
+	EXPECT_EQ( type.GetProperty( 2u )->GetType(), ::rtti::GetTypeInstanceOf< std::string >() );
+	ASSERT_NE( type.GetProperty( 1u )->GetMetadataValue( "Unit" ), nullptr );
+	EXPECT_EQ( *type.GetProperty( 1u )->GetMetadataValue( "Unit" ), "kg" );
+	EXPECT_EQ( type.GetProperty( 2u )->GetMetadataValue( "Unit" ), nullptr );
+
+	// Own properties are linked from constant initialized tables, parent's ones come from the parent.
+	const auto baseTable = ::rtti::internal::StaticPropertiesTableOf< rttiTest::StaticBase >::GetProperties();
+	const auto derivedTable = ::rtti::internal::StaticPropertiesTableOf< rttiTest::StaticDerived >::GetProperties();
+	ASSERT_EQ( derivedTable.size(), 2u );
+	EXPECT_EQ( type.GetProperty( 0u ), &baseTable[ 0u ] );
+	EXPECT_EQ( type.GetProperty( 1u ), &derivedTable[ 0u ] );
+	EXPECT_EQ( type.GetProperty( 2u ), &derivedTable[ 1u ] );
+
+	rttiTest::StaticDerived obj;
+	obj.m_id = 3;
+	obj.m_weight = 1.5f;
+	obj.m_label = "Label";
+
+	std::string names;
+	Double sum = 0.0;
+	::rtti::StaticVisitProperties( std::as_const( obj ), [ & ]( const char* name, const auto& value )
+		{
+			names += name;
+			if constexpr ( std::is_arithmetic_v< std::remove_cvref_t< decltype( value ) > > )
+			{
+				sum += value;
+			}
+		} );
+	EXPECT_EQ( names, "m_idm_weightm_label" );
+	EXPECT_EQ( sum, 4.5 );
+
+	size_t visited = 0u;
+	::rtti::StaticVisitProperties( obj, [ & ]( const char*, auto& value )
+		{
+			++visited;
+			return ::rtti::VisitOutcome::Break;
+		} );
+	EXPECT_EQ( visited, 1u );
+}
+
+TEST( TestCaseName, StaticHierarchyQueries )
+{
+	static_assert( AAA::InheritsFromStatic< A >() );
+	static_assert( AAA::InheritsFromOrIsAStatic< AAA >() );
+	static_assert( !A::InheritsFromStatic< AA >() );
+	static_assert( !B::InheritsFromOrIsAStatic< A >() );
+	static_assert( abc::AbstractInheritsFromAbstract::InheritsFromStatic< abstract::Abstract >() );
+
+	AAA aaa;
+	A* a = &aaa;
+	EXPECT_EQ( ::rtti::Cast< AAA >( a ), &aaa );
+	EXPECT_EQ( ::rtti::Cast< AA >( static_cast< const A* >( a ) ), &aaa );
+	EXPECT_EQ( ::rtti::Cast< B >( a ), nullptr );
+}
+
+TEST( TestCaseName, StaticTypeStorage )
+{
+	const void* typeAddress = &AAA::GetTypeStatic();
+	EXPECT_EQ( typeAddress, ::rtti::internal::StaticTypeStorage< AAA::Type >::s_memory );
+
+	const auto& vectorType = ::rtti::GetTypeInstanceOf< std::vector< AAA > >();
+	EXPECT_EQ( &vectorType, ::rtti::internal::StaticTypeStorage< std::remove_cvref_t< decltype( vectorType ) > >::s_instance );
+	EXPECT_EQ( &::rtti::RTTI::GetMutable().GetOrRegisterType< AAA::Type >(), &AAA::GetTypeStatic() );
+
+	const auto& runtimeType = ::rtti::RuntimeType<>::Create( "StaticTypeStorageRuntimeType" );
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( "StaticTypeStorageRuntimeType" ), &runtimeType );
+}
+
+TEST( TestCaseName, MemoryStats )
+{
+	auto& runtimeType = ::rtti::RuntimeType<>::Create( "MemoryStatsRuntimeTypeWithAVeryLongNameThatDoesntFitIntoTheLocalBuffer" );
+	runtimeType.AddProperty< Int32 >( "m_value" );
+	runtimeType.AddProperty< Float >( "m_factor" );
+
+	const auto& declaredType = rttiTest::StaticBase::GetTypeStatic();
+	ASSERT_GT( declaredType.GetPropertiesAmount(), 0u );
+
+	const auto stats = ::rtti::RTTI::Get().GetMemoryStats();
+	EXPECT_EQ( stats.m_perType.size(), ::rtti::RTTI::Get().GetTypes().size() );
+	EXPECT_GT( stats.m_registryBytes, 0u );
+	EXPECT_EQ( stats.GetTotalBytes(), stats.m_total.GetTotalBytes() + stats.m_registryBytes );
+
+	::rtti::TypeMemoryStats perKindSum;
+	for ( const auto& [ kind, kindStats ] : stats.m_perKind )
+	{
+		perKindSum += kindStats;
+	}
+	EXPECT_EQ( perKindSum.GetTotalBytes(), stats.m_total.GetTotalBytes() );
+
+	const auto findTypeStats = [ &stats ]( const ::rtti::Type& type )
+	{
+		auto found = std::find_if( stats.m_perType.begin(), stats.m_perType.end(), [ & ]( const auto& entry ) { return entry.first == &type; } );
+		return found != stats.m_perType.end() ? found->second : ::rtti::TypeMemoryStats();
+	};
+
+	const auto runtimeStats = findTypeStats( runtimeType );
+	EXPECT_EQ( runtimeStats.m_typeObjectBytes, sizeof( runtimeType ) );
+	EXPECT_GE( runtimeStats.m_propertiesBytes, 2u * sizeof( ::rtti::Property ) );
+	EXPECT_GT( runtimeStats.m_namesBytes, strlen( runtimeType.GetName() ) );
+
+	const auto declaredStats = findTypeStats( declaredType );
+	EXPECT_EQ( declaredStats.m_typeObjectBytes, sizeof( declaredType ) );
+	EXPECT_GE( declaredStats.m_propertiesBytes, declaredType.GetPropertiesAmount() * sizeof( ::rtti::Property ) );
+	EXPECT_GE( declaredStats.m_methodsBytes, declaredType.GetMethodsAmount() * sizeof( ::rtti::Function ) );
+	EXPECT_EQ( declaredStats.m_namesBytes, 0u );
+	EXPECT_GE( stats.m_perKind.at( ::rtti::Type::Kind::Struct ).m_propertiesBytes, declaredStats.m_propertiesBytes );
+}
+
+TEST( TestCaseName, CompactProperties )
+{
+	static_assert( sizeof( ::rtti::Property ) <= 6u * sizeof( void* ) );
+	static_assert( !std::is_copy_constructible_v< ::rtti::Property > && std::is_nothrow_move_constructible_v< ::rtti::Property > );
+
+	constexpr Uint32 propertiesAmount = 300u;
+	auto& type = ::rtti::RuntimeType<>::Create( "CompactPropertiesRuntimeType" );
+	for ( Uint32 i = 0u; i < propertiesAmount; ++i )
+	{
+		const std::string name = "m_property" + std::to_string( i );
+		type.AddProperty< Int32 >( name.c_str() );
+	}
+
+	ASSERT_EQ( type.GetPropertiesAmount(), propertiesAmount );
+	EXPECT_EQ( type.GetSize(), propertiesAmount * sizeof( Int32 ) );
+
+	// Names are copied into the pool, so they outlive strings they were added from.
+	const auto* property = type.FindProperty( "m_property299" );
+	ASSERT_NE( property, nullptr );
+	EXPECT_STREQ( property->GetName(), "m_property299" );
+	EXPECT_EQ( property->GetOffset(), 299u * sizeof( Int32 ) );
+	EXPECT_EQ( property->GetContainerIndex(), static_cast< size_t >( -1 ) );
+	EXPECT_EQ( ::rtti::internal::NamePool::Get().Intern( "m_property299" ).m_name.data(), property->GetName() );
+
+	Int64 sum = 0;
+	std::unique_ptr< Int32[] > object( new Int32[ propertiesAmount ] );
+	for ( Uint32 i = 0u; i < propertiesAmount; ++i )
+	{
+		object[ i ] = static_cast< Int32 >( i );
+	}
+	for ( size_t i = 0u; i < type.GetPropertiesAmount(); ++i )
+	{
+		sum += type.GetProperty( i )->GetValue< Int32 >( object.get() );
+	}
+	EXPECT_EQ( sum, static_cast< Int64 >( propertiesAmount * ( propertiesAmount - 1u ) / 2u ) );
+
+	EXPECT_FALSE( property->HasMetadata( "Key" ) );
+	EXPECT_EQ( property->GetMetadataValue( "Key" ), nullptr );
+}
+
+TEST( TestCaseName, InternedTypeNames )
+{
+	auto& pool = ::rtti::internal::NamePool::Get();
+	const auto first = pool.Intern( std::string( "InternedTypeNamesTest" ) );
+	const auto second = pool.Intern( "InternedTypeNamesTest" );
+	EXPECT_EQ( first.m_name.data(), second.m_name.data() );
+	EXPECT_EQ( first.m_hash, ::rtti::internal::CalcHash( "InternedTypeNamesTest" ) );
+
+	::rtti::internal::InternedName found;
+	EXPECT_TRUE( pool.Find( "InternedTypeNamesTest", found ) );
+	EXPECT_EQ( found.m_name.data(), first.m_name.data() );
+	EXPECT_FALSE( pool.Find( "InternedTypeNamesTestMissing", found ) );
+
+	const auto& pointerType = ::rtti::GetTypeInstanceOf< const Float* >();
+	EXPECT_STREQ( pointerType.GetName(), "const float*" );
+	EXPECT_TRUE( pool.Find( pointerType.GetName(), found ) );
+	EXPECT_EQ( found.m_name.data(), pointerType.GetName() );
+
+	const auto& vectorType = ::rtti::GetTypeInstanceOf< std::vector< std::unordered_set< Uint16 > > >();
+	EXPECT_TRUE( pool.Find( vectorType.GetName(), found ) );
+	EXPECT_EQ( found.m_name.data(), vectorType.GetName() );
+
+	const auto typeDesc = vectorType.GetInternalTypeDesc();
+	EXPECT_EQ( typeDesc.ConstructName().data(), typeDesc.ConstructName().data() );
+
+	const auto& runtimeType = ::rtti::RuntimeType<>::Create( std::string( "InternedTypeNamesRuntimeType" ) );
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( pool.Intern( "InternedTypeNamesRuntimeType" ) ), &runtimeType );
+	EXPECT_EQ( ::rtti::RTTI::Get().FindType( std::string_view( "InternedTypeNamesRuntimeType" ) ), &runtimeType );
+
+	const auto& enumType = ::rtti::GetTypeInstanceOf< rttiTest::TestEnum >();
+	ASSERT_NE( enumType.FindMember( "Seven" ), nullptr );
+	EXPECT_EQ( enumType.FindMember( "Seven" )->m_value, static_cast< ::rtti::EnumTypeBase::ValueType >( rttiTest::TestEnum::Seven ) );
+	EXPECT_EQ( enumType.FindMember( "Eight" ), nullptr );
+}
+
+namespace rttiTest
+{
+	enum class SparseEnum : Uint64
+	{
+		Small = 1u,
+		Medium = 1000u,
+		Big = 1ull << 40u,
+		Huge = ~0ull,
+		BigAlias = 1ull << 40u,
+	};
+}
+
+RTTI_DECLARE_AND_IMPLEMENT_ENUM( rttiTest::SparseEnum,
+	RTTI_REGISTER_ENUM_MEMBER( Small );
+	RTTI_REGISTER_ENUM_MEMBER( Medium );
+	RTTI_REGISTER_ENUM_MEMBER( Big );
+	RTTI_REGISTER_ENUM_MEMBER( Huge );
+	RTTI_REGISTER_ENUM_MEMBER( BigAlias );
+);
+
+TEST( TestCaseName, EnumLookupTables )
+{
+	const auto& denseType = rtti::GetTypeInstanceOf< rttiTest::TestEnum >();
+	for ( Int32 value = -20; value <= 20; ++value )
+	{
+		const char* name = denseType.GetValueName( static_cast< rttiTest::TestEnum >( value ) );
+		const bool isMember = value == -10 || value == -5 || value == 0 || value == 1 || value == 7;
+		EXPECT_EQ( name != nullptr, isMember );
+	}
+
+	const auto value = rttiTest::TestEnum::MinusTen;
+	ASSERT_NE( denseType.GetCurrentMember( &value ), nullptr );
+	EXPECT_STREQ( denseType.GetCurrentMember( &value )->m_name, "MinusTen" );
+
+	const auto& sparseType = rtti::GetTypeInstanceOf< rttiTest::SparseEnum >();
+	EXPECT_STREQ( sparseType.GetValueName( rttiTest::SparseEnum::Small ), "Small" );
+	EXPECT_STREQ( sparseType.GetValueName( rttiTest::SparseEnum::Medium ), "Medium" );
+	EXPECT_STREQ( sparseType.GetValueName( rttiTest::SparseEnum::Huge ), "Huge" );
+	EXPECT_STREQ( sparseType.GetValueName( rttiTest::SparseEnum::BigAlias ), "Big" );
+	EXPECT_EQ( sparseType.GetValueName( static_cast< rttiTest::SparseEnum >( 2u ) ), nullptr );
+
+	rttiTest::SparseEnum outcome = rttiTest::SparseEnum::Small;
+	EXPECT_TRUE( sparseType.GetValueFromName( "BigAlias", outcome ) );
+	EXPECT_EQ( outcome, rttiTest::SparseEnum::Big );
+	EXPECT_TRUE( sparseType.GetValueFromName( "Huge", outcome ) );
+	EXPECT_EQ( outcome, rttiTest::SparseEnum::Huge );
+	EXPECT_FALSE( sparseType.GetValueFromName( "Tiny", outcome ) );
+	EXPECT_EQ( sparseType.FindMember( "Medium" )->m_value, 1000u );
+}
+
+namespace rttiTest
+{
+	enum class Permissions : Int32
+	{
+		None = 0,
+		Read = 1 << 0,
+		Write = 1 << 1,
+		ReadWrite = Read | Write,
+		Execute = 1 << 2,
+		Admin = 1 << 31,
+	};
+
+	struct FlagsHolder
+	{
+		RTTI_DECLARE_STRUCT( FlagsHolder );
+
+		Permissions m_permissions = Permissions::None;
+		std::vector< Permissions > m_history;
+	};
+}
+
+RTTI_DECLARE_AND_IMPLEMENT_FLAGS_ENUM( rttiTest::Permissions,
+	RTTI_REGISTER_ENUM_MEMBER( None );
+	RTTI_REGISTER_ENUM_MEMBER( Read );
+	RTTI_REGISTER_ENUM_MEMBER( Write );
+	RTTI_REGISTER_ENUM_MEMBER( ReadWrite );
+	RTTI_REGISTER_ENUM_MEMBER( Execute );
+	RTTI_REGISTER_ENUM_MEMBER( Admin );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::FlagsHolder,
+	RTTI_REGISTER_PROPERTY( m_permissions );
+	RTTI_REGISTER_PROPERTY( m_history );
+);
+
+TEST( TestCaseName, FlagsEnum )
+{
+	using rttiTest::Permissions;
+	const auto& type = ::rtti::GetTypeInstanceOf< Permissions >();
+	EXPECT_TRUE( type.IsFlags() );
+	EXPECT_FALSE( ::rtti::GetTypeInstanceOf< rttiTest::TestEnum >().IsFlags() );
+
+	const auto toNames = [ &type ]( Int32 value )
+	{
+		std::string names;
+		return type.AppendFlagNames( static_cast< ::rtti::EnumTypeBase::ValueType >( value ), names ) ? names : std::string( "<failed>" );
+	};
+
+	EXPECT_EQ( toNames( 0 ), "None" );
+	EXPECT_EQ( toNames( 1 | 4 ), "Read|Execute" );
+	EXPECT_EQ( toNames( 1 | 2 ), "ReadWrite" );
+	EXPECT_EQ( toNames( 2 | 4 | ( 1 << 31 ) ), "Write|Execute|Admin" );
+	EXPECT_EQ( toNames( 8 | 1 ), "<failed>" );
+
+	::rtti::EnumTypeBase::ValueType value = 0u;
+	EXPECT_TRUE( type.ParseFlagNames( "Read | Execute", value ) );
+	EXPECT_EQ( value, 5u );
+	EXPECT_TRUE( type.ParseFlagNames( "ReadWrite|Admin", value ) );
+	EXPECT_EQ( static_cast< Permissions >( value ), static_cast< Permissions >( 3 | ( 1 << 31 ) ) );
+	EXPECT_TRUE( type.ParseFlagNames( "", value ) );
+	EXPECT_EQ( value, 0u );
+	EXPECT_FALSE( type.ParseFlagNames( "Read|", value ) );
+	EXPECT_FALSE( type.ParseFlagNames( "Read|Delete", value ) );
+
+	rttiTest::FlagsHolder source;
+	source.m_permissions = static_cast< Permissions >( 1 | 4 );
+	source.m_history = { Permissions::ReadWrite, static_cast< Permissions >( 2 | 4 ), static_cast< Permissions >( 16 ) };
+
+	std::string json;
+	::rtti::JsonSerializer::Save( source, json );
+	EXPECT_NE( json.find( "\"Read|Execute\"" ), std::string::npos );
+	EXPECT_NE( json.find( "\"Write|Execute\"" ), std::string::npos );
+	EXPECT_NE( json.find( "16" ), std::string::npos );
+
+	rttiTest::FlagsHolder loaded;
+	EXPECT_TRUE( ::rtti::JsonSerializer::Load( loaded, json ) );
+	EXPECT_EQ( loaded.m_permissions, source.m_permissions );
+	EXPECT_EQ( loaded.m_history, source.m_history );
+}
+
+TEST( TestCaseName, RuntimeTypeLayoutOptimization )
+{
+	auto& type = ::rtti::RuntimeType<>::Create( "RuntimeTypeLayoutOptimization" );
+	type.AddProperty< Int32 >( "m_first" );
+
+	type.BeginLayout();
+	type.AddProperty< Bool >( "m_flag" );
+	type.AddProperty< Double >( "m_double" );
+	type.AddProperty< Char >( "m_char" );
+	type.AddProperty< Int64 >( "m_coldInt", ::rtti::LayoutGroup::Cold );
+	type.AddProperty< Uint16 >( "m_short" );
+	type.AddProperty< Float >( "m_hotFloat", ::rtti::LayoutGroup::Hot );
+	EXPECT_FALSE( type.IsLayoutFinalized() );
+	const auto report = type.FinalizeLayout();
+	EXPECT_TRUE( type.IsLayoutFinalized() );
+
+	// From offset 4 the declared order spans 36 bytes and the finalized one 28, both rounded up to the alignment of 8.
+	EXPECT_EQ( report.m_declaredOrderSize, 40u );
+	EXPECT_EQ( report.m_finalizedSize, 32u );
+	EXPECT_EQ( report.GetSavedBytes(), 8 );
+
+	ASSERT_EQ( type.GetPropertiesAmount(), 7u );
+	EXPECT_STREQ( type.GetProperty( 1u )->GetName(), "m_flag" );
+	EXPECT_EQ( type.FindProperty( "m_first" )->GetOffset(), 0u );
+	EXPECT_EQ( type.FindProperty( "m_hotFloat" )->GetOffset(), 4u );
+	EXPECT_EQ( type.FindProperty( "m_double" )->GetOffset(), 8u );
+	EXPECT_EQ( type.FindProperty( "m_short" )->GetOffset(), 16u );
+	EXPECT_EQ( type.FindProperty( "m_flag" )->GetOffset(), 18u );
+	EXPECT_EQ( type.FindProperty( "m_char" )->GetOffset(), 19u );
+	EXPECT_EQ( type.FindProperty( "m_coldInt" )->GetOffset(), 24u );
+	EXPECT_EQ( type.GetSize(), 32u );
+	EXPECT_EQ( type.GetAlignment(), 8u );
+
+	// Added after finalizing, placed after the last property.
+	type.AddProperty< Bool >( "m_late" );
+	EXPECT_EQ( type.FindProperty( "m_late" )->GetOffset(), 32u );
+	EXPECT_EQ( type.FinalizeLayout().GetSavedBytes(), 0 );
+
+	// The hot char goes first and the rest has to be padded after it.
+	auto& groupedType = ::rtti::RuntimeType<>::Create( "RuntimeTypeLayoutOptimizationGrouped" );
+	groupedType.BeginLayout();
+	groupedType.AddProperty< Int64 >( "m_int64" );
+	groupedType.AddProperty< Int32 >( "m_int32" );
+	groupedType.AddProperty< Char >( "m_hotChar", ::rtti::LayoutGroup::Hot );
+	const auto groupedReport = groupedType.FinalizeLayout();
+	EXPECT_EQ( groupedReport.m_declaredOrderSize, 16u );
+	EXPECT_EQ( groupedReport.m_finalizedSize, 24u );
+	EXPECT_EQ( groupedReport.GetSavedBytes(), -8 );
+
+	// The parent's last property by index isn't the last one in memory.
+	auto& parentType = ::rtti::RuntimeType<>::Create( "RuntimeTypeLayoutOptimizationParent" );
+	parentType.BeginLayout();
+	parentType.AddProperty< Bool >( "m_flag" );
+	parentType.AddProperty< Double >( "m_double" );
+	parentType.FinalizeLayout();
+	EXPECT_EQ( parentType.FindProperty( "m_double" )->GetOffset(), 0u );
+	EXPECT_EQ( parentType.FindProperty( "m_flag" )->GetOffset(), 8u );
+
+	auto& derivedType = ::rtti::RuntimeType< ::rtti::RuntimeType<> >::Create( "RuntimeTypeLayoutOptimizationDerived", parentType );
+	derivedType.AddProperty< Int32 >( "m_derivedInt" );
+	EXPECT_GE( derivedType.FindProperty( "m_derivedInt" )->GetOffset(), 9u );
+
+	auto& laidOutDerivedType = ::rtti::RuntimeType< ::rtti::RuntimeType<> >::Create( "RuntimeTypeLayoutOptimizationLaidOutDerived", parentType );
+	laidOutDerivedType.BeginLayout();
+	laidOutDerivedType.AddProperty< Bool >( "m_derivedFlag" );
+	laidOutDerivedType.FinalizeLayout();
+	EXPECT_GE( laidOutDerivedType.FindProperty( "m_derivedFlag" )->GetOffset(), 9u );
+}
+
+TEST( TestCaseName, RuntimeTypeLifetimePlan )
+{
+	auto& type = ::rtti::RuntimeType<>::Create( "RuntimeTypeLifetimePlan" );
+	type.AddProperty< Int32 >( "m_int" );
+	type.AddProperty< Float* >( "m_ptr" );
+	type.AddProperty< std::string >( "m_string" );
+	type.AddProperty< Bool >( "m_flag" );
+	type.BeginLayout();
+	type.AddProperty< std::vector< Int32 > >( "m_vector" );
+	type.AddProperty< Uint16 >( "m_byte" );
+	type.AddProperty< Int64 >( "m_long" );
+	type.FinalizeLayout();
+
+
+	alignas( 16 ) uint8_t src[ 128 ];
+	alignas( 16 ) uint8_t dest[ 128 ];
+	ASSERT_LE( type.GetSize(), sizeof( src ) );
+	std::memset( src, 0xCD, sizeof( src ) );
+	std::memset( dest, 0xCD, sizeof( dest ) );
+
+	type.ConstructInPlace( src );
+	EXPECT_EQ( type.FindProperty( "m_int" )->GetValue< Int32 >( src ), 0 );
+	EXPECT_EQ( type.FindProperty( "m_ptr" )->GetValue< Float* >( src ), nullptr );
+	EXPECT_TRUE( type.FindProperty( "m_string" )->GetValue< std::string >( src ).empty() );
+	EXPECT_FALSE( type.FindProperty( "m_flag" )->GetValue< Bool >( src ) );
+	EXPECT_TRUE( type.FindProperty( "m_vector" )->GetValue< std::vector< Int32 > >( src ).empty() );
+	EXPECT_EQ( type.FindProperty( "m_byte" )->GetValue< Uint16 >( src ), 0u );
+	EXPECT_EQ( type.FindProperty( "m_long" )->GetValue< Int64 >( src ), 0 );
+
+	Float value = 1.0f;
+	type.FindProperty( "m_int" )->GetValue< Int32 >( src ) = 7;
+	type.FindProperty( "m_ptr" )->GetValue< Float* >( src ) = &value;
+	type.FindProperty( "m_string" )->GetValue< std::string >( src ) = "A string long enough not to fit into the small buffer";
+	type.FindProperty( "m_flag" )->GetValue< Bool >( src ) = true;
+	type.FindProperty( "m_vector" )->GetValue< std::vector< Int32 > >( src ) = { 1, 2, 3 };
+	type.FindProperty( "m_byte" )->GetValue< Uint16 >( src ) = 200u;
+	type.FindProperty( "m_long" )->GetValue< Int64 >( src ) = -5;
+
+	// Moving assigns to a constructed instance.
+	type.ConstructInPlace( dest );
+	type.MoveInPlace( dest, src );
+	EXPECT_EQ( type.FindProperty( "m_int" )->GetValue< Int32 >( dest ), 7 );
+	EXPECT_EQ( type.FindProperty( "m_ptr" )->GetValue< Float* >( dest ), &value );
+	EXPECT_EQ( type.FindProperty( "m_string" )->GetValue< std::string >( dest ), "A string long enough not to fit into the small buffer" );
+	EXPECT_TRUE( type.FindProperty( "m_flag" )->GetValue< Bool >( dest ) );
+	EXPECT_EQ( type.FindProperty( "m_vector" )->GetValue< std::vector< Int32 > >( dest ), ( std::vector< Int32 >{ 1, 2, 3 } ) );
+	EXPECT_EQ( type.FindProperty( "m_byte" )->GetValue< Uint16 >( dest ), 200u );
+	EXPECT_EQ( type.FindProperty( "m_long" )->GetValue< Int64 >( dest ), -5 );
+
+	type.Destroy( src );
+	type.Destroy( dest );
 }
\ No newline at end of file
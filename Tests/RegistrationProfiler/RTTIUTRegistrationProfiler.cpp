@@ -0,0 +1,124 @@
+// Replaces the global operator new and delete to count allocations of registrations, so it's kept away from the other tests.
+#define RTTI_CFG_REGISTRATION_PROFILER 1
+#include "gtest/gtest.h"
+#include "../../LibeRTTI.h"
+#include <optional>
+
+#define TestCaseName RTTIRegistrationProfiler
+
+typedef __int32 Int32;
+typedef unsigned short Uint16;
+typedef unsigned Uint32;
+
+void* operator new( size_t size )
+{
+	::rtti::RegistrationProfiler::RecordAllocation( size );
+	if ( void* memory = std::malloc( size ? size : 1u ) )
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new( size_t size, const std::nothrow_t& ) noexcept
+{
+	::rtti::RegistrationProfiler::RecordAllocation( size );
+	return std::malloc( size ? size : 1u );
+}
+
+void operator delete( void* memory ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete( void* memory, const std::nothrow_t& ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete( void* memory, size_t ) noexcept
+{
+	std::free( memory );
+}
+
+namespace rttiTest
+{
+	class ProfiledBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( ProfiledBase );
+
+	public:
+		virtual ~ProfiledBase() = default;
+
+		Int32 m_value = 0;
+	};
+
+	class ProfiledDerived : public ProfiledBase
+	{
+		RTTI_DECLARE_POLYMORPHIC_CLASS( ProfiledDerived, ProfiledBase );
+
+	public:
+		std::vector< Int32 > m_values;
+	};
+}
+
+RTTI_IMPLEMENT_TYPE( rttiTest::ProfiledBase,
+	RTTI_REGISTER_PROPERTY( m_value );
+);
+
+RTTI_IMPLEMENT_TYPE( rttiTest::ProfiledDerived,
+	RTTI_REGISTER_PROPERTY( m_values );
+);
+
+TEST( TestCaseName, RegistrationProfiler )
+{
+	auto& profiler = ::rtti::RegistrationProfiler::Get();
+	const auto findRecord = [ &profiler ]( const char* name ) -> std::optional< ::rtti::TypeRegistrationRecord >
+	{
+		for ( const auto& record : profiler.GetRecords() )
+		{
+			if ( record.m_name == name )
+			{
+				return record;
+			}
+		}
+
+		return std::nullopt;
+	};
+
+	// Registered during static initialization.
+	const auto staticRecord = findRecord( "rttiTest::ProfiledDerived" );
+	ASSERT_TRUE( staticRecord.has_value() );
+	EXPECT_EQ( staticRecord->m_id, rttiTest::ProfiledDerived::GetTypeStatic().GetID() );
+	EXPECT_FALSE( staticRecord->m_isMembersRegistration );
+	EXPECT_LE( staticRecord->m_start, staticRecord->m_onRegisteredStart );
+	EXPECT_LE( staticRecord->m_onRegisteredStart, staticRecord->m_onRegisteredEnd );
+	EXPECT_LE( staticRecord->m_onRegisteredEnd, staticRecord->m_end );
+
+	profiler.Clear();
+	const auto& mapType = ::rtti::GetTypeInstanceOf< std::unordered_map< Uint16, std::vector< std::unordered_set< Uint16 > > > >();
+	const auto mapRecord = findRecord( mapType.GetName() );
+	ASSERT_TRUE( mapRecord.has_value() );
+	EXPECT_GT( mapRecord->m_allocationsAmount, 0u );
+	EXPECT_GT( mapRecord->m_allocatedBytes, 0u );
+
+	// Synthetic load, thousands of types registered in a row.
+	constexpr Uint32 typesAmount = 2000u;
+	for ( Uint32 i = 0u; i < typesAmount; ++i )
+	{
+		auto& type = ::rtti::RuntimeType<>::Create( "ProfiledRuntimeType" + std::to_string( i ) );
+		type.AddProperty< Int32 >( "m_value" );
+	}
+
+	const auto records = profiler.GetRecords();
+	EXPECT_GE( records.size(), typesAmount + 1u );
+	EXPECT_TRUE( findRecord( "ProfiledRuntimeType1999" ).has_value() );
+
+	std::string json;
+	profiler.WriteChromeTrace( json );
+	EXPECT_EQ( json.rfind( "{\"traceEvents\":[", 0 ), 0u );
+	EXPECT_NE( json.find( "\"name\":\"ProfiledRuntimeType0\",\"cat\":\"Registration\"" ), std::string::npos );
+	EXPECT_NE( json.find( "\"cat\":\"OnRegistered\"" ), std::string::npos );
+	EXPECT_EQ( std::count( json.begin(), json.end(), '\n' ), static_cast< std::ptrdiff_t >( records.size() * 2u + 2u ) );
+}
\ No newline at end of file